@@ -0,0 +1,125 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+#include <cmath>
+
+#include "../src/audio/apu.h"
+#include "../src/audio/audio-filter-chain.h"
+#include "../src/audio/blip-buffer.h"
+#include "../src/audio/audio-constants.h"
+
+static constexpr int CPU_CYCLES_PER_FRAME = 29781;
+static constexpr int OUTPUT_SAMPLE_RATE = 44100;
+
+static void EnableAllChannels(APU& apu)
+{
+    apu.Write(0x4015, 0x0F);
+
+    apu.Write(0x4000, 0xBF);
+    apu.Write(0x4002, 0xFD);
+    apu.Write(0x4003, 0x00);
+
+    apu.Write(0x4004, 0x7F);
+    apu.Write(0x4006, 0x7E);
+    apu.Write(0x4007, 0x01);
+
+    apu.Write(0x4008, 0xFF);
+    apu.Write(0x400A, 0x40);
+    apu.Write(0x400B, 0x00);
+
+    apu.Write(0x400C, 0x3F);
+    apu.Write(0x400E, 0x04);
+    apu.Write(0x400F, 0x00);
+}
+
+// Clocks the APU for one frame worth of CPU cycles with every channel producing sound.
+static void BM_ApuClock_AllChannels(benchmark::State& state)
+{
+    APU apu(OUTPUT_SAMPLE_RATE);
+    std::vector<float> samples;
+    EnableAllChannels(apu);
+
+    for (auto _ : state)
+    {
+        for (int i = 0; i < CPU_CYCLES_PER_FRAME; i++)
+            apu.Clock();
+
+        apu.ReadSamples(samples);
+        benchmark::DoNotOptimize(samples.data());
+        samples.clear();
+    }
+
+    state.SetItemsProcessed(state.iterations() * CPU_CYCLES_PER_FRAME);
+}
+BENCHMARK(BM_ApuClock_AllChannels);
+
+// The same frame run in one call, as the bus does between register writes, so only audible events are clocked
+static void BM_ApuRunUntil_AllChannels(benchmark::State& state)
+{
+    APU apu(OUTPUT_SAMPLE_RATE);
+    std::vector<float> samples;
+    EnableAllChannels(apu);
+    uint64_t cycleCount = 0;
+
+    for (auto _ : state)
+    {
+        cycleCount += CPU_CYCLES_PER_FRAME;
+        apu.RunUntil(cycleCount);
+
+        apu.ReadSamples(samples);
+        benchmark::DoNotOptimize(samples.data());
+        samples.clear();
+    }
+
+    state.SetItemsProcessed(state.iterations() * CPU_CYCLES_PER_FRAME);
+}
+BENCHMARK(BM_ApuRunUntil_AllChannels);
+
+static std::vector<float> BuildFrameOfSamples()
+{
+    std::vector<float> samples(CPU_CYCLES_PER_FRAME);
+    for (int i = 0; i < CPU_CYCLES_PER_FRAME; i++)
+        samples[i] = 0.25f * std::sin(i * 0.01f) + ((i / 40) % 2 ? 0.1f : -0.1f);
+    return samples;
+}
+
+static void BM_AudioFilterChain_Process(benchmark::State& state)
+{
+    const std::vector<float> source = BuildFrameOfSamples();
+    std::vector<float> buffer;
+    AudioFilterChain filterChain(OUTPUT_SAMPLE_RATE);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        buffer = source;
+        state.ResumeTiming();
+
+        filterChain.Process(buffer);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * CPU_CYCLES_PER_FRAME);
+}
+BENCHMARK(BM_AudioFilterChain_Process);
+
+// A frame of square wave steps at roughly the rate a busy pulse channel produces them
+static void BM_BlipBuffer_Frame(benchmark::State& state)
+{
+    constexpr int CYCLES_PER_STEP = 40;
+    BlipBuffer blipBuffer(AudioConstants::CLOCK_RATE, OUTPUT_SAMPLE_RATE);
+    std::vector<float> output;
+
+    for (auto _ : state)
+    {
+        for (int cycle = 0; cycle < CPU_CYCLES_PER_FRAME; cycle += CYCLES_PER_STEP)
+            blipBuffer.AddDelta(cycle, (cycle / CYCLES_PER_STEP) % 2 ? -0.2F : 0.2F);
+
+        blipBuffer.EndFrame(CPU_CYCLES_PER_FRAME);
+        blipBuffer.ReadSamples(output);
+        benchmark::DoNotOptimize(output.data());
+        output.clear();
+    }
+
+    state.SetItemsProcessed(state.iterations() * CPU_CYCLES_PER_FRAME);
+}
+BENCHMARK(BM_BlipBuffer_Frame);
\ No newline at end of file
@@ -0,0 +1,32 @@
+#include <benchmark/benchmark.h>
+#include <string_view>
+#include <vector>
+
+#include "../src/debug/logger.h"
+
+// Results are written as JSON unless a format is given so runs can be diffed across commits.
+int main(int argc, char** argv)
+{
+    // Keep stdout clean for the JSON reporter
+    Logger::GetInstance().SetLoggingMode(Logger::LoggingMode::Disabled);
+
+    std::vector<char*> arguments(argv, argv + argc);
+
+    bool formatSpecified = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::string_view(argv[i]).starts_with("--benchmark_format"))
+            formatSpecified = true;
+    }
+
+    char jsonFormat[] = "--benchmark_format=json";
+    if (!formatSpecified) arguments.push_back(jsonFormat);
+
+    int argumentCount = static_cast<int>(arguments.size());
+    benchmark::Initialize(&argumentCount, arguments.data());
+    if (benchmark::ReportUnrecognizedArguments(argumentCount, arguments.data())) return 1;
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
\ No newline at end of file
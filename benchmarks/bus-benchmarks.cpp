@@ -0,0 +1,72 @@
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <cstdint>
+
+#include "../src/cpu/cpu-bus.h"
+#include "../src/ppu/ppu.h"
+#include "../src/ppu/ppu-bus.h"
+#include "../src/audio/apu.h"
+#include "../src/cartridge/cartridge.h"
+#include "synthetic-roms.h"
+
+// Builds a CPU bus with everything connected so each address range decodes to a real device.
+static std::shared_ptr<CpuBus> BuildConnectedBus()
+{
+    auto cartridge = std::make_shared<Cartridge>();
+    cartridge->LoadROM(SyntheticRoms::CpuLoop().image);
+
+    auto ppuBus = std::make_shared<PpuBus>();
+    ppuBus->ConnectCartridge(cartridge);
+
+    auto bus = std::make_shared<CpuBus>();
+    bus->ConnectControllers(std::make_shared<uint8_t>(0), std::make_shared<uint8_t>(0));
+    bus->ConnectCartridge(cartridge);
+    bus->ConnectPPU(std::make_shared<PPU>(ppuBus));
+    bus->ConnectAPU(std::make_shared<APU>(44100));
+    return bus;
+}
+
+static void BM_CpuBusRead_Ram(benchmark::State& state)
+{
+    auto bus = BuildConnectedBus();
+    uint16_t address = 0;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(bus->Read(address));
+        address = (address + 1) & 0x1FFF;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CpuBusRead_Ram);
+
+static void BM_CpuBusRead_Cartridge(benchmark::State& state)
+{
+    auto bus = BuildConnectedBus();
+    uint16_t address = 0x8000;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(bus->Read(address));
+        address = 0x8000 | ((address + 1) & 0x7FFF);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CpuBusRead_Cartridge);
+
+static void BM_CpuBusWrite_Ram(benchmark::State& state)
+{
+    auto bus = BuildConnectedBus();
+    uint16_t address = 0;
+
+    for (auto _ : state)
+    {
+        bus->Write(address, static_cast<uint8_t>(address));
+        address = (address + 1) & 0x1FFF;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CpuBusWrite_Ram);
\ No newline at end of file
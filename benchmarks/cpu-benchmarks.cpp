@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <cstdint>
+#include <initializer_list>
+
+#include "../src/cpu/cpu.h"
+#include "../tests/fakes/fake-cpu-bus.h"
+
+static void LoadProgram(TestCpuBus& bus, uint16_t address, std::initializer_list<uint8_t> bytes)
+{
+    for (uint8_t byte : bytes) bus.Write(address++, byte);
+}
+
+// Loads a loop mixing zero page, absolute indexed, indirect indexed, read-modify-write,
+// stack and branch instructions so most addressing modes show up in the profile.
+static std::shared_ptr<TestCpuBus> BuildInstructionMixBus()
+{
+    auto bus = std::make_shared<TestCpuBus>();
+
+    LoadProgram(*bus, 0x8000, {
+        0xA2, 0x00,         // 8000: LDX #$00
+        0xB5, 0x10,         // 8002: LDA $10,X
+        0x69, 0x07,         // 8004: ADC #$07
+        0x9D, 0x00, 0x03,   // 8006: STA $0300,X
+        0xBD, 0x00, 0x03,   // 8009: LDA $0300,X
+        0x4A,               // 800C: LSR A
+        0x26, 0x20,         // 800D: ROL $20
+        0x20, 0x20, 0x80,   // 800F: JSR $8020
+        0xE8,               // 8012: INX
+        0xD0, 0xED,         // 8013: BNE $8002
+        0x4C, 0x00, 0x80,   // 8015: JMP $8000
+    });
+
+    LoadProgram(*bus, 0x8020, {
+        0x48,               // 8020: PHA
+        0xA0, 0x04,         // 8021: LDY #$04
+        0xB1, 0x30,         // 8023: LDA ($30),Y
+        0x68,               // 8025: PLA
+        0x60,               // 8026: RTS
+    });
+
+    LoadProgram(*bus, 0x0030, { 0x00, 0x03 });
+    LoadProgram(*bus, CPU::RESET_VECTOR, { 0x00, 0x80 });
+    return bus;
+}
+
+static void BM_CpuClock_InstructionMix(benchmark::State& state)
+{
+    auto cpu = std::make_shared<CPU>(BuildInstructionMixBus());
+
+    constexpr int CYCLES_PER_ITERATION = 1000;
+    for (auto _ : state)
+    {
+        for (int i = 0; i < CYCLES_PER_ITERATION; i++)
+            cpu->Clock();
+    }
+
+    state.SetItemsProcessed(state.iterations() * CYCLES_PER_ITERATION);
+}
+BENCHMARK(BM_CpuClock_InstructionMix);
+
+// Same program as above, run an instruction at a time through the fast path
+static void BM_CpuStep_InstructionMix(benchmark::State& state)
+{
+    auto cpu = std::make_shared<CPU>(BuildInstructionMixBus());
+
+    constexpr int CYCLES_PER_ITERATION = 1000;
+    int64_t cycles = 0;
+    for (auto _ : state)
+    {
+        int iterationCycles = 0;
+        while (iterationCycles < CYCLES_PER_ITERATION)
+            iterationCycles += cpu->Step();
+        cycles += iterationCycles;
+    }
+
+    state.SetItemsProcessed(cycles);
+}
+BENCHMARK(BM_CpuStep_InstructionMix);
\ No newline at end of file
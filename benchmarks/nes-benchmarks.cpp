@@ -0,0 +1,37 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+#include "../src/nes.h"
+#include "synthetic-roms.h"
+
+// Runs whole frames of a synthetic ROM through the complete console.
+static void BM_NesRunFrame(benchmark::State& state, SyntheticRom (*buildRom)(), NES::CpuExecutionMode cpuMode)
+{
+    NES nes(buildRom().image);
+    nes.SetCpuExecutionMode(cpuMode);
+    uint64_t startCycles = nes.GetCpuCycleCount();
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(nes.RunFrame());
+        nes.GetAudioSamples().clear();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.counters["cpu_cycles"] = benchmark::Counter(
+        static_cast<double>(nes.GetCpuCycleCount() - startCycles), benchmark::Counter::kIsRate);
+}
+static constexpr NES::CpuExecutionMode CYCLE_ACCURATE = NES::CpuExecutionMode::CycleAccurate;
+static constexpr NES::CpuExecutionMode INSTRUCTION_STEP = NES::CpuExecutionMode::InstructionStep;
+
+BENCHMARK_CAPTURE(BM_NesRunFrame, cpu_loop, &SyntheticRoms::CpuLoop, CYCLE_ACCURATE);
+BENCHMARK_CAPTURE(BM_NesRunFrame, ppu_traffic, &SyntheticRoms::PpuTraffic, CYCLE_ACCURATE);
+BENCHMARK_CAPTURE(BM_NesRunFrame, scroll_split, &SyntheticRoms::ScrollSplit, CYCLE_ACCURATE);
+BENCHMARK_CAPTURE(BM_NesRunFrame, sprite_heavy, &SyntheticRoms::SpriteHeavy, CYCLE_ACCURATE);
+BENCHMARK_CAPTURE(BM_NesRunFrame, apu_channels, &SyntheticRoms::ApuChannels, CYCLE_ACCURATE);
+
+BENCHMARK_CAPTURE(BM_NesRunFrame, cpu_loop_fast_cpu, &SyntheticRoms::CpuLoop, INSTRUCTION_STEP);
+BENCHMARK_CAPTURE(BM_NesRunFrame, ppu_traffic_fast_cpu, &SyntheticRoms::PpuTraffic, INSTRUCTION_STEP);
+BENCHMARK_CAPTURE(BM_NesRunFrame, scroll_split_fast_cpu, &SyntheticRoms::ScrollSplit, INSTRUCTION_STEP);
+BENCHMARK_CAPTURE(BM_NesRunFrame, sprite_heavy_fast_cpu, &SyntheticRoms::SpriteHeavy, INSTRUCTION_STEP);
+BENCHMARK_CAPTURE(BM_NesRunFrame, apu_channels_fast_cpu, &SyntheticRoms::ApuChannels, INSTRUCTION_STEP);
\ No newline at end of file
@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <cstdint>
+#include <vector>
+
+#include "../src/ppu/ppu.h"
+#include "../src/ppu/ppu-bus.h"
+#include "../src/cartridge/cartridge.h"
+#include "synthetic-roms.h"
+
+static constexpr int64_t DOTS_PER_FRAME = 341 * 262;
+
+// Clocks the PPU through whole frames (341 dots x 262 scanlines) with the given PPUMASK value.
+// Batched runs go through RunUntil a scanline at a time, the way the console catches the PPU up.
+static void RunPpuFrames(benchmark::State& state, uint8_t mask, bool batched = false, bool indexed = false)
+{
+    auto cartridge = std::make_shared<Cartridge>();
+    cartridge->LoadROM(SyntheticRoms::CpuLoop().image);
+
+    auto bus = std::make_shared<PpuBus>();
+    bus->ConnectCartridge(cartridge);
+
+    // Give the background something other than tile zero to draw
+    for (uint16_t address = 0x2000; address < 0x2400; address++)
+        bus->Write(address, static_cast<uint8_t>(address * 7));
+    for (uint16_t address = 0x3F00; address < 0x3F20; address++)
+        bus->Write(address, static_cast<uint8_t>(address * 3));
+
+    auto ppu = std::make_shared<PPU>(bus);
+    for (int i = 0; i < 256; i++)
+        ppu->WriteByteToOAM(static_cast<uint8_t>(i), static_cast<uint8_t>(i * 13));
+    ppu->Write(0x2001, mask);
+    ppu->SetIndexedOutput(indexed);
+
+    uint64_t dotCount = 0;
+    for (auto _ : state)
+    {
+        while (!ppu->FrameIsComplete())
+        {
+            if (batched) ppu->RunUntil(dotCount += 341);
+            else ppu->Clock();
+        }
+
+        ppu->ClearFrameComplete();
+        benchmark::DoNotOptimize(ppu->GetPixelBuffer());
+    }
+
+    state.SetItemsProcessed(state.iterations() * DOTS_PER_FRAME);
+}
+
+static void BM_PpuFrame_RenderingOn(benchmark::State& state)
+{
+    RunPpuFrames(state, 0x1E);
+}
+BENCHMARK(BM_PpuFrame_RenderingOn);
+
+static void BM_PpuFrame_RenderingOn_Batched(benchmark::State& state)
+{
+    RunPpuFrames(state, 0x1E, true);
+}
+BENCHMARK(BM_PpuFrame_RenderingOn_Batched);
+
+static void BM_PpuFrame_RenderingOn_BatchedIndexed(benchmark::State& state)
+{
+    RunPpuFrames(state, 0x1E, true, true);
+}
+BENCHMARK(BM_PpuFrame_RenderingOn_BatchedIndexed);
+
+// Converts a whole indexed frame to RGBA, the cost indexed output defers until a frame is presented
+static void BM_PpuConvertFrame(benchmark::State& state)
+{
+    auto ppu = std::make_shared<PPU>(std::make_shared<PpuBus>());
+    std::vector<uint32_t> pixels(PPU::DISPLAY_WIDTH * PPU::DISPLAY_HEIGHT);
+
+    for (auto _ : state)
+    {
+        ppu->ConvertFrame(PixelFormat::RGBA8888, pixels.data(), PPU::DISPLAY_WIDTH * sizeof(uint32_t));
+        benchmark::DoNotOptimize(pixels.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * PPU::DISPLAY_WIDTH * PPU::DISPLAY_HEIGHT);
+}
+BENCHMARK(BM_PpuConvertFrame);
+
+static void BM_PpuFrame_RenderingOff(benchmark::State& state)
+{
+    RunPpuFrames(state, 0x00);
+}
+BENCHMARK(BM_PpuFrame_RenderingOff);
\ No newline at end of file
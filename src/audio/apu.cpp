@@ -1,6 +1,6 @@
 #include "apu.h"
 
-APU::APU()
+APU::APU(int sampleRate) : m_blipBuffer(AudioConstants::CLOCK_RATE, sampleRate)
 {
     m_frameCounter = std::make_unique<FrameCounter>(m_pulseChannel, m_triangleChannel, m_noiseChannel);
     m_pulseChannel[0].SetChannelNumber(1);
@@ -13,6 +13,7 @@ APU::~APU()
 
 void APU::Clock()
 {
+    m_cycleCount++;
     m_frameCounter->Clock();
 
     m_pulseChannel[0].Clock();
@@ -20,11 +21,70 @@ void APU::Clock()
     m_triangleChannel.Clock();
     m_noiseChannel.Clock();
 
-    float pulseSample = 95.88F / ((8128.0F / (m_pulseChannel[0].Sample() + m_pulseChannel[1].Sample())) + 100.0F);
-    float tndSample = 159.79F / ((1.0F / ((m_triangleChannel.Sample() / 8227.0F) + (m_noiseChannel.Sample() / 12241.0F) /* Add other channels here */)) + 100.0F);
-    float mixedSample = pulseSample + tndSample;
+    MixOutput();
+}
+
+void APU::RunUntil(uint64_t cycleCount)
+{
+    while (m_cycleCount < cycleCount)
+    {
+        uint64_t eventCycle = m_outputIsStale ? m_cycleCount + 1 : std::min(GetNextEventCycle(), cycleCount);
+
+        // Nothing audible happens before the event, so every unit jumps straight to the cycle before it
+        uint64_t quietUntil = eventCycle - 1;
+        if (quietUntil > m_cycleCount)
+        {
+            m_frameCounter->RunUntil(quietUntil);
+            m_pulseChannel[0].RunUntil(quietUntil);
+            m_pulseChannel[1].RunUntil(quietUntil);
+            m_triangleChannel.RunUntil(quietUntil);
+            m_noiseChannel.RunUntil(quietUntil);
+            m_cycleCount = quietUntil;
+        }
+
+        // The event cycle itself is clocked normally so frame counter ticks land before that cycle's timer reloads
+        Clock();
+    }
+}
+
+uint64_t APU::GetNextEventCycle() const
+{
+    return std::min({
+        m_frameCounter->GetNextTickCycle(),
+        m_pulseChannel[0].GetNextStepCycle(),
+        m_pulseChannel[1].GetNextStepCycle(),
+        m_triangleChannel.GetNextStepCycle(),
+        m_noiseChannel.GetNextStepCycle()
+    });
+}
+
+void APU::MixOutput()
+{
+    m_outputIsStale = false;
+
+    // Every channel outputs a level from 0 to 15
+    uint8_t pulseOne = m_pulseChannel[0].Sample();
+    uint8_t pulseTwo = m_pulseChannel[1].Sample();
+    uint8_t triangle = m_triangleChannel.Sample();
+    uint8_t noise = m_noiseChannel.Sample();
+
+    uint16_t channelLevels = pulseOne | (pulseTwo << 4) | (triangle << 8) | (noise << 12);
+    if (channelLevels == m_channelLevels) return;
+    m_channelLevels = channelLevels;
 
-    m_sampleBuffer.push_back(mixedSample * AudioConstants::MASTER_VOLUME);
+    float pulseSample = PULSE_MIXER_LOOKUP[pulseOne + pulseTwo];
+    float tndSample = TND_MIXER_LOOKUP[3 * triangle + 2 * noise /* + DMC level once that channel exists */];
+    float output = (pulseSample + tndSample) * AudioConstants::MASTER_VOLUME;
+
+    m_blipBuffer.AddDelta(m_cycleCount - m_frameStartCycle, output - m_output);
+    m_output = output;
+}
+
+void APU::ReadSamples(std::vector<float>& output)
+{
+    m_blipBuffer.EndFrame(m_cycleCount - m_frameStartCycle);
+    m_frameStartCycle = m_cycleCount;
+    m_blipBuffer.ReadSamples(output);
 }
 
 uint8_t APU::Read(uint16_t address)
@@ -34,6 +94,8 @@ uint8_t APU::Read(uint16_t address)
 
 void APU::Write(uint16_t address, uint8_t data)
 {
+    m_outputIsStale = true;
+
     switch (address)
     {
     case 0x4000:
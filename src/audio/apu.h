@@ -4,15 +4,23 @@
 #include <vector>
 #include <memory>
 #include <format>
+#include <algorithm>
 
 #include "frame-counter.h"
 #include "pulse-wave-generator.h"
 #include "triangle-wave-generator.h"
 #include "noise-generator.h"
+#include "blip-buffer.h"
+#include "mixer-lookup.h"
 
 class APU
 {
-    std::vector<float> m_sampleBuffer;
+    // The mixed output only changes when a channel's level does, so only those changes are synthesised
+    BlipBuffer m_blipBuffer;
+    uint16_t m_channelLevels = 0;
+    float m_output = 0.0F;
+    bool m_outputIsStale = true; // Set when a write may have changed a level outside of the channels' own events
+    uint64_t m_frameStartCycle = 0;
 
     std::unique_ptr<FrameCounter> m_frameCounter;
 
@@ -20,14 +28,25 @@ class APU
     TriangleWaveGenerator m_triangleChannel;
     NoiseGenerator m_noiseChannel;
 
+    uint64_t m_cycleCount = 0;
+
 public:
-    APU();
+    APU(int sampleRate);
     ~APU();
 
     void Clock();
 
+    // Runs the APU until it has run the given number of CPU cycles in total. Only cycles on which a channel's level
+    // can change are clocked; the quiet stretches between them are skipped in one step.
+    void RunUntil(uint64_t cycleCount);
+
     uint8_t Read(uint16_t address);
     void Write(uint16_t address, uint8_t data);
 
-    std::vector<float>& GetBuffer() { return m_sampleBuffer; }
+    // Appends the audio for every cycle run since the last call, at the sample rate given on construction
+    void ReadSamples(std::vector<float>& output);
+
+private:
+    uint64_t GetNextEventCycle() const;
+    void MixOutput();
 };
\ No newline at end of file
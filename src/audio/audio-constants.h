@@ -1,7 +1,13 @@
 #pragma once
 
+#include <cstdint>
+#include <limits>
+
 namespace AudioConstants
 {
     static constexpr int CLOCK_RATE = 1789773;
     static constexpr float MASTER_VOLUME = 0.1;
+
+    // Returned as the next event cycle by units whose output can't change until they are written to
+    static constexpr uint64_t NEVER = std::numeric_limits<uint64_t>::max();
 };
\ No newline at end of file
@@ -0,0 +1,101 @@
+#include "audio-filter-chain.h"
+
+#include <numbers>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define AUDIO_FILTER_CHAIN_SSE2
+#endif
+
+AudioFilterChain::AudioFilterChain(double sampleRate)
+{
+    m_stages[0] = MakeHighPass(90.0, sampleRate);
+    m_stages[1] = MakeHighPass(440.0, sampleRate);
+    m_stages[2] = MakeLowPass(14000.0, sampleRate);
+}
+
+void AudioFilterChain::Process(std::span<float> samples)
+{
+    for (Stage& stage : m_stages)
+        ProcessStage(stage, samples.data(), samples.size());
+}
+
+AudioFilterChain::Stage AudioFilterChain::MakeHighPass(double cutoffFrequency, double sampleRate)
+{
+    // y[n] = a * (y[n-1] + x[n] - x[n-1])
+    double rc = 1.0 / (2.0 * std::numbers::pi * cutoffFrequency);
+    double alpha = rc / (rc + 1.0 / sampleRate);
+
+    Stage stage;
+    stage.highPass = true;
+    stage.feedback = static_cast<float>(alpha);
+    stage.inputGain = static_cast<float>(alpha);
+    return stage;
+}
+
+AudioFilterChain::Stage AudioFilterChain::MakeLowPass(double cutoffFrequency, double sampleRate)
+{
+    // y[n] = y[n-1] + a * (x[n] - y[n-1])
+    double rc = 1.0 / (2.0 * std::numbers::pi * cutoffFrequency);
+    double alpha = (1.0 / sampleRate) / (rc + 1.0 / sampleRate);
+
+    Stage stage;
+    stage.highPass = false;
+    stage.feedback = static_cast<float>(1.0 - alpha);
+    stage.inputGain = static_cast<float>(alpha);
+    return stage;
+}
+
+void AudioFilterChain::ProcessStage(Stage& stage, float* samples, size_t count)
+{
+    size_t i = 0;
+
+#if defined(AUDIO_FILTER_CHAIN_SSE2)
+    // Four outputs at a time: a prefix scan over the lanes gives each one its share of the earlier inputs in the
+    // group, then the output carried in from the previous group is added with the matching power of the feedback
+    const float a = stage.feedback;
+    const __m128 feedback = _mm_set1_ps(a);
+    const __m128 feedbackSquared = _mm_set1_ps(a * a);
+    const __m128 feedbackPowers = _mm_setr_ps(a, a * a, a * a * a, a * a * a * a);
+    const __m128 inputGain = _mm_set1_ps(stage.inputGain);
+    __m128 previousInput = _mm_set1_ps(stage.previousInput);
+    __m128 previousOutput = _mm_set1_ps(stage.previousOutput);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 input = _mm_loadu_ps(samples + i);
+
+        __m128 scan;
+        if (stage.highPass)
+        {
+            // Each lane's previous input is the lane before it, or the last input of the previous group
+            __m128 shiftedInput = _mm_move_ss(_mm_shuffle_ps(input, input, _MM_SHUFFLE(2, 1, 0, 0)), previousInput);
+            scan = _mm_mul_ps(inputGain, _mm_sub_ps(input, shiftedInput));
+        }
+        else
+        {
+            scan = _mm_mul_ps(inputGain, input);
+        }
+
+        scan = _mm_add_ps(scan, _mm_mul_ps(feedback, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(scan), 4))));
+        scan = _mm_add_ps(scan, _mm_mul_ps(feedbackSquared, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(scan), 8))));
+        __m128 output = _mm_add_ps(scan, _mm_mul_ps(feedbackPowers, previousOutput));
+
+        _mm_storeu_ps(samples + i, output);
+        previousInput = _mm_shuffle_ps(input, input, _MM_SHUFFLE(3, 3, 3, 3));
+        previousOutput = _mm_shuffle_ps(output, output, _MM_SHUFFLE(3, 3, 3, 3));
+    }
+
+    stage.previousInput = _mm_cvtss_f32(previousInput);
+    stage.previousOutput = _mm_cvtss_f32(previousOutput);
+#endif
+
+    for (; i < count; i++)
+    {
+        float input = samples[i];
+        float scan = stage.highPass ? stage.inputGain * (input - stage.previousInput) : stage.inputGain * input;
+        stage.previousOutput = stage.feedback * stage.previousOutput + scan;
+        stage.previousInput = input;
+        samples[i] = stage.previousOutput;
+    }
+}
\ No newline at end of file
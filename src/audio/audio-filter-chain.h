@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+// The console's output filters: two first-order high-pass filters (90 Hz and 440 Hz) followed by a first-order
+// low-pass filter at 14 kHz. The filters carry their state from one block of samples to the next, so blocks can be
+// any size without clicks at the boundaries.
+class AudioFilterChain
+{
+    // Every stage is run as y[n] = feedback * y[n-1] + u[n], with u[n] worked out from the input first
+    struct Stage
+    {
+        bool highPass = false;
+        float feedback = 0.0F;
+        float inputGain = 0.0F;
+        float previousInput = 0.0F;
+        float previousOutput = 0.0F;
+    };
+
+    static constexpr size_t STAGE_COUNT = 3;
+    Stage m_stages[STAGE_COUNT];
+
+public:
+    AudioFilterChain(double sampleRate);
+
+    // Filters the samples in place
+    void Process(std::span<float> samples);
+
+private:
+    static Stage MakeHighPass(double cutoffFrequency, double sampleRate);
+    static Stage MakeLowPass(double cutoffFrequency, double sampleRate);
+    static void ProcessStage(Stage& stage, float* samples, size_t count);
+};
\ No newline at end of file
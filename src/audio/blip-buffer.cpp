@@ -0,0 +1,68 @@
+#include "blip-buffer.h"
+
+#include <cmath>
+#include <numbers>
+#include <algorithm>
+
+BlipBuffer::BlipBuffer(double clockRate, double sampleRate) : m_kernel(&GetKernel())
+{
+    m_outputSamplesPerClock = static_cast<uint64_t>(std::llround(sampleRate / clockRate * std::pow(2.0, TIME_FRACTION_BITS)));
+}
+
+void BlipBuffer::EndFrame(uint64_t clockDuration)
+{
+    m_frameStart += clockDuration * m_outputSamplesPerClock;
+
+    // Make room for every completed sample even if nothing changed during the frame
+    size_t samplesAvailable = m_frameStart >> TIME_FRACTION_BITS;
+    if (samplesAvailable + KERNEL_SIZE > m_deltas.size()) m_deltas.resize(samplesAvailable + KERNEL_SIZE);
+}
+
+void BlipBuffer::ReadSamples(std::vector<float>& output)
+{
+    size_t samplesAvailable = m_frameStart >> TIME_FRACTION_BITS;
+    if (samplesAvailable == 0) return;
+
+    for (size_t i = 0; i < samplesAvailable; i++)
+    {
+        m_integrator += m_deltas[i];
+        output.push_back(static_cast<float>(m_integrator));
+    }
+
+    // Keep the tails of steps that reach past the samples just read
+    std::copy(m_deltas.begin() + samplesAvailable, m_deltas.end(), m_deltas.begin());
+    std::fill(m_deltas.end() - samplesAvailable, m_deltas.end(), 0.0F);
+    m_frameStart -= static_cast<uint64_t>(samplesAvailable) << TIME_FRACTION_BITS;
+}
+
+const BlipBuffer::Kernel& BlipBuffer::GetKernel()
+{
+    static const Kernel kernel = []
+    {
+        // Blackman windowed sinc with its cutoff a little under the output's Nyquist frequency
+        constexpr double CUTOFF = 0.45;
+
+        Kernel result{};
+        for (int phase = 0; phase < PHASE_COUNT; phase++)
+        {
+            double sum = 0.0;
+            std::array<double, KERNEL_SIZE> taps{};
+            for (int i = 0; i < KERNEL_SIZE; i++)
+            {
+                double x = i - (KERNEL_HALF_WIDTH - 1) - static_cast<double>(phase) / PHASE_COUNT;
+                double sinc = x == 0.0 ? 1.0 : std::sin(std::numbers::pi * 2.0 * CUTOFF * x) / (std::numbers::pi * 2.0 * CUTOFF * x);
+                double window = 0.42 + 0.5 * std::cos(std::numbers::pi * x / KERNEL_HALF_WIDTH)
+                    + 0.08 * std::cos(2.0 * std::numbers::pi * x / KERNEL_HALF_WIDTH);
+                taps[i] = sinc * window;
+                sum += taps[i];
+            }
+
+            // Every step has to add up to exactly its size whatever its phase
+            for (int i = 0; i < KERNEL_SIZE; i++)
+                result[phase][i] = static_cast<float>(taps[i] / sum);
+        }
+        return result;
+    }();
+
+    return kernel;
+}
\ No newline at end of file
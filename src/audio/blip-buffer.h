@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <vector>
+
+// Band-limited step synthesis. Sources add the changes in their amplitude at the clock they happen on, and each
+// change is drawn into the output as a step already low-passed for the output rate, so output samples come
+// straight out of the buffer with no oversampled intermediate signal or aliasing from resampling one.
+class BlipBuffer
+{
+    static constexpr int PHASE_BITS = 5;
+    static constexpr int PHASE_COUNT = 1 << PHASE_BITS;
+    static constexpr int KERNEL_HALF_WIDTH = 8;
+    static constexpr int KERNEL_SIZE = KERNEL_HALF_WIDTH * 2;
+
+    // Output positions are 32.32 fixed point numbers of output samples
+    static constexpr int TIME_FRACTION_BITS = 32;
+
+    using Kernel = std::array<std::array<float, KERNEL_SIZE>, PHASE_COUNT>;
+
+    const Kernel* m_kernel;
+    uint64_t m_outputSamplesPerClock;
+    uint64_t m_frameStart = 0;
+
+    // Differences between consecutive output samples, summed into m_integrator as they are read
+    std::vector<float> m_deltas;
+    double m_integrator = 0.0;
+
+public:
+    BlipBuffer(double clockRate, double sampleRate);
+
+    // Adds a change in amplitude at the given number of clocks into the current frame
+    void AddDelta(uint64_t clockTime, float delta)
+    {
+        uint64_t position = m_frameStart + clockTime * m_outputSamplesPerClock;
+        size_t index = position >> TIME_FRACTION_BITS;
+        int phase = (position >> (TIME_FRACTION_BITS - PHASE_BITS)) & (PHASE_COUNT - 1);
+
+        if (index + KERNEL_SIZE > m_deltas.size()) m_deltas.resize(index + KERNEL_SIZE);
+
+        const std::array<float, KERNEL_SIZE>& step = (*m_kernel)[phase];
+        float* deltas = &m_deltas[index];
+        for (int i = 0; i < KERNEL_SIZE; i++)
+            deltas[i] += delta * step[i];
+    }
+
+    // Ends the current frame after the given number of clocks. Later deltas are timed from the end of it.
+    void EndFrame(uint64_t clockDuration);
+
+    // Appends every output sample completed by the frames ended so far
+    void ReadSamples(std::vector<float>& output);
+
+private:
+    // Each phase is the impulse response of a step that far between two output samples. The step is complete
+    // KERNEL_HALF_WIDTH samples after the one it falls in, which is the buffer's only latency.
+    static const Kernel& GetKernel();
+};
\ No newline at end of file
@@ -11,6 +11,7 @@ FrameCounter::~FrameCounter()
 
 void FrameCounter::Clock()
 {
+    m_cycleCount++;
     m_clockAccumulator += 1;
 
     if (!m_fiveStepModeEnabled && m_clockAccumulator >= FOUR_STEP_TICK_THRESHOLD)
@@ -33,6 +34,31 @@ void FrameCounter::Clock()
     }
 }
 
+void FrameCounter::RunUntil(uint64_t cycleCount)
+{
+    while (m_cycleCount < cycleCount)
+    {
+        uint64_t tickCycle = std::min(GetNextTickCycle(), cycleCount);
+
+        // The accumulator only holds small whole steps past the last threshold, so adding the cycles at once is exact
+        m_clockAccumulator += static_cast<double>(tickCycle - 1 - m_cycleCount);
+        m_cycleCount = tickCycle - 1;
+        Clock();
+    }
+}
+
+uint64_t FrameCounter::GetNextTickCycle() const
+{
+    double threshold = m_fiveStepModeEnabled ? FIVE_STEP_TICK_THRESHOLD : FOUR_STEP_TICK_THRESHOLD;
+
+    // Clock ticks on the first cycle that takes the accumulator to the threshold
+    uint64_t cycles = static_cast<uint64_t>(std::max(1.0, std::ceil(threshold - m_clockAccumulator)));
+    while (m_clockAccumulator + static_cast<double>(cycles) < threshold) cycles++;
+    while (cycles > 1 && m_clockAccumulator + static_cast<double>(cycles - 1) >= threshold) cycles--;
+
+    return m_cycleCount + cycles;
+}
+
 void FrameCounter::SetFiveStepMode(bool value)
 {
     m_clockAccumulator = 0;
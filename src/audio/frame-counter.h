@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cstdint>
+#include <cmath>
+#include <algorithm>
 
 #include "audio-constants.h"
 #include "pulse-wave-generator.h"
@@ -15,6 +17,7 @@ class FrameCounter
     bool m_fiveStepModeEnabled = false;
     uint8_t m_frameStep = 0; // Value 1-5 holding most recent step given the current mode
     double m_clockAccumulator = 0;
+    uint64_t m_cycleCount = 0;
 
     PulseWaveGenerator (&m_pulseChannel)[2];
     TriangleWaveGenerator& m_triangleChannel;
@@ -27,6 +30,12 @@ public:
     void Clock();
     void SetFiveStepMode(bool value);
 
+    // Runs the frame counter until it has run the given number of CPU cycles in total, ticking on the way
+    void RunUntil(uint64_t cycleCount);
+
+    // The cycle on which the next quarter or fifth frame tick lands
+    uint64_t GetNextTickCycle() const;
+
 private:
     void FourStepTick();
     void FiveStepTick();
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+// The APU's nonlinear mixer as lookup tables, using the usual linear approximation of the TND formula.
+// The pulse table is indexed by the sum of both pulse levels (0 - 30), the TND table by
+// 3 * triangle + 2 * noise + DMC (0 - 202).
+
+constexpr std::array<float, 31> PULSE_MIXER_LOOKUP = []
+{
+    std::array<float, 31> lookup{};
+    for (int i = 1; i < 31; i++) lookup[i] = 95.52F / (8128.0F / i + 100.0F);
+    return lookup;
+}();
+
+constexpr std::array<float, 203> TND_MIXER_LOOKUP = []
+{
+    std::array<float, 203> lookup{};
+    for (int i = 1; i < 203; i++) lookup[i] = 163.67F / (24329.0F / i + 100.0F);
+    return lookup;
+}();
\ No newline at end of file
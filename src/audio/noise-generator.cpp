@@ -10,20 +10,12 @@ NoiseGenerator::~NoiseGenerator()
 
 void NoiseGenerator::Clock()
 {
+    m_cycleCount++;
+
     if (m_timer == 0)
     {
         m_timer = m_timerPeriod;
-        
-        uint8_t selectedBit = m_modeFlag ? 6 : 1;
-        bool feedback = (m_linearFeedbackShiftRegister & 1)
-            ^ ((m_linearFeedbackShiftRegister & (1 << selectedBit)) >> selectedBit);
-
-        m_linearFeedbackShiftRegister >>= 1;
-
-        if (feedback)
-            m_linearFeedbackShiftRegister |= 0x4000;
-        else
-            m_linearFeedbackShiftRegister &= ~0x4000;
+        ShiftFeedbackRegister();
     }
     else
     {
@@ -31,10 +23,58 @@ void NoiseGenerator::Clock()
     }
 }
 
-float NoiseGenerator::Sample() const
+void NoiseGenerator::RunUntil(uint64_t cycleCount)
+{
+    if (cycleCount <= m_cycleCount) return;
+    uint64_t cycles = cycleCount - m_cycleCount;
+    m_cycleCount = cycleCount;
+
+    if (cycles <= m_timer)
+    {
+        m_timer -= cycles;
+        return;
+    }
+
+    // After the first reload the timer reloads once every period + 1 cycles
+    cycles -= m_timer + 1;
+    uint64_t reloads = 1 + cycles / (m_timerPeriod + 1);
+    m_timer = m_timerPeriod - cycles % (m_timerPeriod + 1);
+
+    // The shift register has no closed form, but it only moves once per reload
+    for (uint64_t i = 0; i < reloads; i++)
+        ShiftFeedbackRegister();
+}
+
+uint64_t NoiseGenerator::GetNextStepCycle() const
+{
+    if (IsSilent()) return AudioConstants::NEVER;
+    return m_cycleCount + m_timer + 1;
+}
+
+void NoiseGenerator::ShiftFeedbackRegister()
+{
+    uint8_t selectedBit = m_modeFlag ? 6 : 1;
+    bool feedback = (m_linearFeedbackShiftRegister & 1)
+        ^ ((m_linearFeedbackShiftRegister & (1 << selectedBit)) >> selectedBit);
+
+    m_linearFeedbackShiftRegister >>= 1;
+
+    if (feedback)
+        m_linearFeedbackShiftRegister |= 0x4000;
+    else
+        m_linearFeedbackShiftRegister &= ~0x4000;
+}
+
+bool NoiseGenerator::IsSilent() const
+{
+    if (m_lengthCounter == 0) return true;
+    return (m_constantVolume ? m_volume : m_envelope.GetVolume()) == 0;
+}
+
+uint8_t NoiseGenerator::Sample() const
 {
-    if (m_linearFeedbackShiftRegister & 1) return 0.0F;
-    if (m_lengthCounter == 0) return 0.0F;
+    if (m_linearFeedbackShiftRegister & 1) return 0;
+    if (m_lengthCounter == 0) return 0;
 
     return m_constantVolume ? m_volume : m_envelope.GetVolume();
 }
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 
+#include "audio-constants.h"
 #include "envelope.h"
 #include "length-counter-lookup.h"
 
@@ -28,12 +29,20 @@ class NoiseGenerator
 
     uint8_t m_volume = 0;
 
+    uint64_t m_cycleCount = 0;
+
 public:
     NoiseGenerator();
     ~NoiseGenerator();
 
     void Clock();
-    float Sample() const;
+    uint8_t Sample() const; // Output level from 0 to 15
+
+    // Runs the channel until it has run the given number of CPU cycles in total, jumping from reload to reload
+    void RunUntil(uint64_t cycleCount);
+
+    // The cycle on which the output can next change, or NEVER if it stays silent until the channel is written to
+    uint64_t GetNextStepCycle() const;
 
     void SetEnabled(bool value);
     inline void SetInfinitePlayFlag(bool value) { m_infinitePlay = value; m_envelope.SetLoopMode(value); }
@@ -47,4 +56,8 @@ public:
     void RestartEnvelope() { m_envelope.Restart(); }
 
     void ClockLengthCounter();
+
+private:
+    void ShiftFeedbackRegister();
+    bool IsSilent() const;
 };
\ No newline at end of file
@@ -10,6 +10,7 @@ PulseWaveGenerator::~PulseWaveGenerator()
 
 void PulseWaveGenerator::Clock()
 {
+    m_cycleCount++;
     m_isOddClockCycle = !m_isOddClockCycle;
     if (m_isOddClockCycle) return;
 
@@ -24,13 +25,52 @@ void PulseWaveGenerator::Clock()
     }
 }
 
-float PulseWaveGenerator::Sample() const
+void PulseWaveGenerator::RunUntil(uint64_t cycleCount)
 {
-    if (!m_enabled) return 0.0F;
-    if (!(m_sequence & (0x80 >> m_sequenceStep))) return 0.0F;
-    if (m_sweepTargetPeriod > 0x7FF) return 0.0F;
-    if (m_lengthCounter == 0) return 0.0F;
-    if (m_timerPeriod < 8) return 0.0F;
+    if (cycleCount <= m_cycleCount) return;
+    uint64_t cycles = cycleCount - m_cycleCount;
+    m_cycleCount = cycleCount;
+
+    // The timer is only clocked on every other cycle
+    uint64_t timerClocks = m_isOddClockCycle ? (cycles + 1) / 2 : cycles / 2;
+    if (cycles & 1) m_isOddClockCycle = !m_isOddClockCycle;
+
+    if (timerClocks <= m_timer)
+    {
+        m_timer -= timerClocks;
+        return;
+    }
+
+    // After the first reload the timer reloads once every period + 1 clocks
+    timerClocks -= m_timer + 1;
+    uint64_t reloads = 1 + timerClocks / (m_timerPeriod + 1);
+    m_timer = m_timerPeriod - timerClocks % (m_timerPeriod + 1);
+    m_sequenceStep = (m_sequenceStep + reloads) % 8;
+}
+
+uint64_t PulseWaveGenerator::GetNextStepCycle() const
+{
+    if (IsSilent()) return AudioConstants::NEVER;
+
+    uint64_t cyclesUntilTimerClock = m_isOddClockCycle ? 1 : 2;
+    return m_cycleCount + cyclesUntilTimerClock + 2 * static_cast<uint64_t>(m_timer);
+}
+
+bool PulseWaveGenerator::IsSilent() const
+{
+    if (!m_enabled || m_sequence == 0) return true;
+    if (m_sweepTargetPeriod > 0x7FF || m_lengthCounter == 0 || m_timerPeriod < 8) return true;
+
+    return (m_constantVolume ? m_volume : m_envelope.GetVolume()) == 0;
+}
+
+uint8_t PulseWaveGenerator::Sample() const
+{
+    if (!m_enabled) return 0;
+    if (!(m_sequence & (0x80 >> m_sequenceStep))) return 0;
+    if (m_sweepTargetPeriod > 0x7FF) return 0;
+    if (m_lengthCounter == 0) return 0;
+    if (m_timerPeriod < 8) return 0;
     
     return m_constantVolume ? m_volume : m_envelope.GetVolume();
 }
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 
+#include "audio-constants.h"
 #include "envelope.h"
 #include "length-counter-lookup.h"
 #include "../debug/logger.h"
@@ -37,12 +38,20 @@ class PulseWaveGenerator
 
     uint8_t m_channelNumber = 0;
 
+    uint64_t m_cycleCount = 0;
+
 public:
     PulseWaveGenerator();
     ~PulseWaveGenerator();
 
     void Clock();
-    float Sample() const;
+    uint8_t Sample() const; // Output level from 0 to 15
+
+    // Runs the channel until it has run the given number of CPU cycles in total, jumping from reload to reload
+    void RunUntil(uint64_t cycleCount);
+
+    // The cycle on which the output can next change, or NEVER if it stays silent until the channel is written to
+    uint64_t GetNextStepCycle() const;
 
     void SetEnabled(bool value);
     void SetDuty(uint8_t duty);
@@ -64,4 +73,7 @@ public:
     void UpdateSweepSettings(uint8_t settings);
     void CalculateSweepTargetPeriod();
     void ClockSweepUnit();
+
+private:
+    bool IsSilent() const;
 };
\ No newline at end of file
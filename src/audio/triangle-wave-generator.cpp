@@ -10,11 +10,13 @@ TriangleWaveGenerator::~TriangleWaveGenerator()
 
 void TriangleWaveGenerator::Clock()
 {
+    m_cycleCount++;
+
     if (m_timer == 0)
     {
         m_timer = m_timerPeriod;
 
-        if (m_linearCounter > 0 && m_lengthCounter > 0)
+        if (!SequencerIsHalted())
             m_sequenceStep = (m_sequenceStep + 1) % 32;
     }
     else
@@ -23,7 +25,34 @@ void TriangleWaveGenerator::Clock()
     }
 }
 
-float TriangleWaveGenerator::Sample() const
+void TriangleWaveGenerator::RunUntil(uint64_t cycleCount)
+{
+    if (cycleCount <= m_cycleCount) return;
+    uint64_t cycles = cycleCount - m_cycleCount;
+    m_cycleCount = cycleCount;
+
+    if (cycles <= m_timer)
+    {
+        m_timer -= cycles;
+        return;
+    }
+
+    // After the first reload the timer reloads once every period + 1 cycles
+    cycles -= m_timer + 1;
+    uint64_t reloads = 1 + cycles / (m_timerPeriod + 1);
+    m_timer = m_timerPeriod - cycles % (m_timerPeriod + 1);
+
+    if (!SequencerIsHalted())
+        m_sequenceStep = (m_sequenceStep + reloads) % 32;
+}
+
+uint64_t TriangleWaveGenerator::GetNextStepCycle() const
+{
+    if (SequencerIsHalted()) return AudioConstants::NEVER;
+    return m_cycleCount + m_timer + 1;
+}
+
+uint8_t TriangleWaveGenerator::Sample() const
 {
     return TRIANGLE_SEQUENCE[m_sequenceStep];
 }
@@ -2,12 +2,13 @@
 
 #include <cstdint>
 
+#include "audio-constants.h"
 #include "length-counter-lookup.h"
 
-const float TRIANGLE_SEQUENCE[]
+const uint8_t TRIANGLE_SEQUENCE[]
 {
-    15.0F, 14.0F, 13.0F, 12.0F, 11.0F, 10.0F, 9.0F, 8.0F, 7.0F, 6.0F, 5.0F, 4.0F, 3.0F, 2.0F, 1.0F, 0.0F,
-    0.0F, 1.0F, 2.0F, 3.0F, 4.0F, 5.0F, 6.0F, 7.0F, 8.0F, 9.0F, 10.0F, 11.0F, 12.0F, 13.0F, 14.0F, 15.0F
+    15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15
 };
 
 class TriangleWaveGenerator
@@ -27,12 +28,20 @@ class TriangleWaveGenerator
 
     uint8_t m_sequenceStep = 0;
 
+    uint64_t m_cycleCount = 0;
+
 public:
     TriangleWaveGenerator();
     ~TriangleWaveGenerator();
 
     void Clock();
-    float Sample() const;
+    uint8_t Sample() const; // Output level from 0 to 15
+
+    // Runs the channel until it has run the given number of CPU cycles in total, jumping from reload to reload
+    void RunUntil(uint64_t cycleCount);
+
+    // The cycle on which the output can next change, or NEVER if the sequencer is halted
+    uint64_t GetNextStepCycle() const;
 
     void SetEnabled(bool value);
     void SetControlFlag(bool value) { m_controlFlag = value; }
@@ -43,4 +52,7 @@ public:
 
     void ClockLengthCounter();
     void ClockLinearCounter();
+
+private:
+    bool SequencerIsHalted() const { return m_linearCounter == 0 || m_lengthCounter == 0; }
 };
\ No newline at end of file
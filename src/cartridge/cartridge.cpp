@@ -8,6 +8,15 @@ Cartridge::~Cartridge()
 {
 }
 
+void Cartridge::CpuWrite(uint16_t address, uint8_t data)
+{
+    MirrorMode previousMirrorMode = GetMirrorMode();
+    m_mapper->CpuWrite(address, data);
+
+    MirrorMode mirrorMode = GetMirrorMode();
+    if (mirrorMode != previousMirrorMode && m_mirrorModeListener) m_mirrorModeListener(mirrorMode);
+}
+
 void Cartridge::LoadROM(const std::string& filename)
 {
     std::ifstream file;
@@ -18,13 +27,24 @@ void Cartridge::LoadROM(const std::string& filename)
         throw std::runtime_error("Failed to open file: " + filename);
     }
 
+    LoadROM(file, filename);
+    file.close();
+}
+
+void Cartridge::LoadROM(const std::vector<uint8_t>& romData)
+{
+    std::istringstream stream(std::string(romData.begin(), romData.end()), std::ios_base::binary);
+    LoadROM(stream, "memory");
+}
+
+void Cartridge::LoadROM(std::istream& romStream, const std::string& sourceName)
+{
     // Read and validate the header
-    file.read(reinterpret_cast<char*>(&m_header), sizeof(RomHeader));
+    romStream.read(reinterpret_cast<char*>(&m_header), sizeof(RomHeader));
     if (m_header.signature[0] != 'N' || m_header.signature[1] != 'E' ||
         m_header.signature[2] != 'S' || m_header.signature[3] != 0x1A) 
     {
-        file.close();
-        throw std::runtime_error("Invalid NES file format: " + filename);
+        throw std::runtime_error("Invalid NES file format: " + sourceName);
     }
 
     // Set mirror mode
@@ -35,26 +55,24 @@ void Cartridge::LoadROM(const std::string& filename)
 
     // Discard trainer if present
     if (m_header.flags6 & 0x04)
-        file.seekg(512, std::ios_base::cur);
+        romStream.seekg(512, std::ios_base::cur);
 
     // Load PRG ROM
     size_t prgSize = m_header.prgRomSize * 16 * 1024;
     m_prgRom.resize(prgSize);
-    file.read(reinterpret_cast<char*>(m_prgRom.data()), prgSize);
+    romStream.read(reinterpret_cast<char*>(m_prgRom.data()), prgSize);
 
     // Load CHR ROM (if present)
     size_t chrSize = m_header.chrRomSize * 8 * 1024;
     if (chrSize == 0) chrSize = 8 * 1024;
     m_chrRom.resize(chrSize);
-    file.read(reinterpret_cast<char*>(m_chrRom.data()), chrSize);
-
-    file.close();
+    romStream.read(reinterpret_cast<char*>(m_chrRom.data()), chrSize);
 
     // Fetch the mapper ID and create the mapper
     uint8_t mapperID = (m_header.flags7 & 0xF0) | (m_header.flags6 >> 4);
     CreateMapper(mapperID);
 
-    Logger::GetInstance().Log(std::format("Loaded {} bytes of PRG ROM and {} bytes of CHR ROM from {}", prgSize, chrSize, filename));
+    Logger::GetInstance().Log(std::format("Loaded {} bytes of PRG ROM and {} bytes of CHR ROM from {}", prgSize, chrSize, sourceName));
 }
 
 void Cartridge::CreateMapper(uint8_t mapperID)
@@ -6,8 +6,10 @@
 #include <memory>
 #include <iostream>
 #include <fstream>
+#include <sstream>
 #include <format>
 #include <stdexcept>
+#include <functional>
 
 #include "../debug/logger.h"
 #include "mirror-mode.h"
@@ -36,17 +38,27 @@ public:
     ~Cartridge();
 
     void LoadROM(const std::string& filename);
+    void LoadROM(const std::vector<uint8_t>& romData);
 
     uint8_t CpuRead(uint16_t address) { return m_mapper->CpuRead(address); }
-    void CpuWrite(uint16_t address, uint8_t data) { m_mapper->CpuWrite(address, data); }
+    void CpuWrite(uint16_t address, uint8_t data);
 
     uint8_t PpuRead(uint16_t address) { return m_mapper->PpuRead(address); }
     void PpuWrite(uint16_t address, uint8_t data) { m_mapper->PpuWrite(address, data); }
 
     MirrorMode GetMirrorMode() { return m_mapper->GetMirrorMode().value_or(m_mirrorMode); }
 
+    // Called with the new mode whenever a mapper register write changes the nametable mirroring
+    void SetMirrorModeListener(std::function<void(MirrorMode)> listener) { m_mirrorModeListener = std::move(listener); }
+
     bool PollIrqInterrupt() { return m_mapper->PollIrqInterrupt(); }
 
+    const Mapper::PrgBanks& GetPrgReadBanks() const { return m_mapper->GetPrgReadBanks(); }
+    const Mapper::PrgBanks& GetPrgWriteBanks() const { return m_mapper->GetPrgWriteBanks(); }
+    const Mapper::ChrBanks& GetChrBanks() const { return m_mapper->GetChrBanks(); }
+    const std::vector<uint8_t>& GetChrMemory() const { return m_chrRom; }
+    bool PollPrgBankSwitch() { return m_mapper->PollPrgBankSwitch(); }
+
 private:
     RomHeader m_header{};
 
@@ -56,6 +68,8 @@ private:
     std::vector<uint8_t> m_chrRom;  // CHR ROM data
 
     MirrorMode m_mirrorMode = MirrorMode::Horizontal;
+    std::function<void(MirrorMode)> m_mirrorModeListener;
 
+    void LoadROM(std::istream& romStream, const std::string& sourceName);
     void CreateMapper(uint8_t mapperID);
 };
\ No newline at end of file
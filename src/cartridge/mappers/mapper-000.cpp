@@ -1,37 +1,16 @@
 #include "mapper-000.h"
 
-uint8_t Mapper000::CpuRead(uint16_t address)
+Mapper000::Mapper000(std::vector<uint8_t>& prgRom, std::vector<uint8_t>& chrRom) : Mapper(prgRom, chrRom)
 {
-    if (address >= 0x8000 && address <= 0xFFFF) {
-        uint16_t offset = address - 0x8000;
-        return m_prgRom[offset % m_prgRom.size()];
-    }
+    // 16 KB carts are mirrored into both halves of 0x8000 - 0xFFFF
+    for (size_t bank = 0; bank < 4; bank++)
+        MapPrgRom(4 + bank, bank * PRG_BANK_SIZE);
 
-    Logger::GetInstance().Warn("CPU tried to read from the cartridge at an unexpected address " + Logger::DecmialToHex(address));
-    return 0;
+    for (size_t bank = 0; bank < CHR_BANK_COUNT; bank++)
+        MapChr(bank, bank * CHR_BANK_SIZE);
 }
 
 void Mapper000::CpuWrite(uint16_t address, uint8_t data)
 {
     Logger::GetInstance().Warn("CPU tried to write to the cartridge at an unexpected address " + Logger::DecmialToHex(address));
 }
-
-uint8_t Mapper000::PpuRead(uint16_t address)
-{
-    if (address >= 0x0000 && address <= 0x1FFF)
-        return m_chrRom[address];
-
-    Logger::GetInstance().Warn("PPU tried to read from the cartridge at an unexpected address " + Logger::DecmialToHex(address));
-    return 0;
-}
-
-void Mapper000::PpuWrite(uint16_t address, uint8_t data)
-{
-    if (address >= 0x0000 && address <= 0x1FFF)
-    {
-        m_chrRom[address] = data;
-        return;
-    }
-
-    Logger::GetInstance().Warn("PPU tried to write to the cartridge at an unexpected address " + Logger::DecmialToHex(address));
-}
@@ -3,38 +3,8 @@
 Mapper001::Mapper001(std::vector<uint8_t>& prgRom, std::vector<uint8_t>& chrRom) 
     : Mapper(prgRom, chrRom), m_prgRam(0x2000)
 {
-}
-
-uint8_t Mapper001::CpuRead(uint16_t address)
-{
-    if (address < 0x6000)
-    {
-        Logger::GetInstance().Warn("unexpected CPU read in mapper 1 below 0x6000");
-        return 0;
-    }
-
-    if (address >= 0x6000 && address < 0x8000) return m_prgRam[address & 0x1FFF];
-
-    address -= 0x8000;
-    const uint8_t prgRomBankMode = (m_controlReg >> 2) & 3;
-    uint32_t translatedAddress;
-
-    if (prgRomBankMode == 2) // Fix first 16 KB bank (0x8000 - 0xBFFF)
-    {
-        if (address < 0x4000) translatedAddress = address;
-        else translatedAddress = (m_prgBankReg & 0b01111) * 0x4000 + (address & 0x3FFF);
-    }
-    else if (prgRomBankMode == 3) // Fix second 16 KB bank (0xC000 - 0xFFFF)
-    {
-        if (address >= 0x4000) translatedAddress = (m_prgRom.size() - 0x4000) + (address & 0x3FFF);
-        else translatedAddress = (m_prgBankReg & 0b01111) * 0x4000 + address;
-    }
-    else // Use one 32 KB bank
-    {
-        translatedAddress = ((m_prgBankReg & 0b01111) >> 1) * 0x8000 + address;
-    }
-
-    return m_prgRom[translatedAddress];
+    MapPrgRam(3, m_prgRam.data());
+    UpdateBanks();
 }
 
 void Mapper001::CpuWrite(uint16_t address, uint8_t data)
@@ -56,6 +26,7 @@ void Mapper001::CpuWrite(uint16_t address, uint8_t data)
     {
         m_loadReg = 0b10000;
         m_controlReg |= 0b01100;
+        UpdateBanks();
         return;
     }
 
@@ -72,6 +43,7 @@ void Mapper001::CpuWrite(uint16_t address, uint8_t data)
         *targetReg = (m_loadReg >> 1) & 0b01111;
         *targetReg |= (data & 1) << 4;
         m_loadReg = 0b10000;
+        UpdateBanks();
         return;
     }
 
@@ -80,37 +52,44 @@ void Mapper001::CpuWrite(uint16_t address, uint8_t data)
     m_loadReg |= (data & 1) << 4;
 }
 
-uint8_t Mapper001::PpuRead(uint16_t address)
+void Mapper001::UpdateBanks()
 {
-    if (address >= 0x2000)
+    const uint8_t prgRomBankMode = (m_controlReg >> 2) & 3;
+    const size_t prgBank = m_prgBankReg & 0b01111;
+    size_t lowerBankOffset; // 0x8000 - 0xBFFF
+    size_t upperBankOffset; // 0xC000 - 0xFFFF
+
+    if (prgRomBankMode == 2) // Fix first 16 KB bank (0x8000 - 0xBFFF)
     {
-        Logger::GetInstance().Warn("PPU tried to write to the cartridge at an unexpected address " + Logger::DecmialToHex(address));
-        return 0;
+        lowerBankOffset = 0;
+        upperBankOffset = prgBank * 0x4000;
     }
-
-    uint32_t translatedAddress;
-    if (m_controlReg & 0b10000) // Split 4 KB bank mode
+    else if (prgRomBankMode == 3) // Fix second 16 KB bank (0xC000 - 0xFFFF)
     {
-        if (address < 0x1000) translatedAddress = m_chrBankZeroReg * 0x1000 + address;
-        else translatedAddress = m_chrBankOneReg * 0x1000 + (address & 0x0FFF);
+        lowerBankOffset = prgBank * 0x4000;
+        upperBankOffset = m_prgRom.size() - 0x4000;
     }
-    else // Single 8 KB bank mode
+    else // Use one 32 KB bank
     {
-        translatedAddress = (m_chrBankZeroReg >> 1) * 0x2000 + address;
+        lowerBankOffset = (prgBank >> 1) * 0x8000;
+        upperBankOffset = lowerBankOffset + 0x4000;
     }
 
-    return m_chrRom[translatedAddress];
-}
+    MapPrgRom(4, lowerBankOffset);
+    MapPrgRom(5, lowerBankOffset + PRG_BANK_SIZE);
+    MapPrgRom(6, upperBankOffset);
+    MapPrgRom(7, upperBankOffset + PRG_BANK_SIZE);
 
-void Mapper001::PpuWrite(uint16_t address, uint8_t data)
-{
-    if (address >= 0x0000 && address <= 0x1FFF)
+    for (size_t bank = 0; bank < CHR_BANK_COUNT; bank++)
     {
-        m_chrRom[address] = data;
-        return;
-    }
+        size_t offset;
+        if (m_controlReg & 0b10000) // Split 4 KB bank mode
+            offset = (bank < 4 ? m_chrBankZeroReg : m_chrBankOneReg) * 0x1000 + (bank & 3) * CHR_BANK_SIZE;
+        else // Single 8 KB bank mode
+            offset = (m_chrBankZeroReg >> 1) * 0x2000 + bank * CHR_BANK_SIZE;
 
-    Logger::GetInstance().Warn("PPU tried to write to the cartridge at an unexpected address " + Logger::DecmialToHex(address));
+        MapChr(bank, offset);
+    }
 }
 
 std::optional<MirrorMode> Mapper001::GetMirrorMode()
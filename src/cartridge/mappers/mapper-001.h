@@ -18,14 +18,12 @@ class Mapper001 : public Mapper
 
 	std::vector<uint8_t> m_prgRam;
 
+	void UpdateBanks();
+
 public:
 	Mapper001(std::vector<uint8_t>& prgRom, std::vector<uint8_t>& chrRom);
 
-	uint8_t CpuRead(uint16_t address) override;
 	void CpuWrite(uint16_t address, uint8_t data) override;
 
-	uint8_t PpuRead(uint16_t address) override;
-	void PpuWrite(uint16_t address, uint8_t data) override;
-
 	virtual std::optional<MirrorMode> GetMirrorMode() override;
 };
\ No newline at end of file
@@ -4,25 +4,10 @@ Mapper002::Mapper002(std::vector<uint8_t>& prgRom, std::vector<uint8_t>& chrRom)
 {
     m_dynamicBank = 0;
     m_fixedBank = (prgRom.size() / 16 / 1024) - 1;
-}
-
-uint8_t Mapper002::CpuRead(uint16_t address)
-{
-    uint16_t offset;
-
-    if (address >= 0x8000 && address < 0xC000)
-    {
-        offset = address - 0x8000;
-        return m_prgRom[(m_dynamicBank * 16 * 1024) + offset];
-    }
-    else if (address >= 0xC000)
-    {
-        offset = address - 0xC000;
-        return m_prgRom[(m_fixedBank * 16 * 1024) + offset];
-    }
+    UpdatePrgBanks();
 
-    Logger::GetInstance().Warn("CPU tried to read from the cartridge at an unexpected address " + Logger::DecmialToHex(address));
-    return 0;
+    for (size_t bank = 0; bank < CHR_BANK_COUNT; bank++)
+        MapChr(bank, bank * CHR_BANK_SIZE);
 }
 
 void Mapper002::CpuWrite(uint16_t address, uint8_t data)
@@ -30,28 +15,18 @@ void Mapper002::CpuWrite(uint16_t address, uint8_t data)
     if (address >= 0x8000)
     {
         m_dynamicBank = data & 0x0F;
+        UpdatePrgBanks();
         return;
     }
 
     Logger::GetInstance().Warn("CPU tried to write to the cartridge at an unexpected address " + Logger::DecmialToHex(address));
 }
 
-uint8_t Mapper002::PpuRead(uint16_t address)
+void Mapper002::UpdatePrgBanks()
 {
-    if (address >= 0x0000 && address <= 0x1FFF)
-        return m_chrRom[address];
-
-    Logger::GetInstance().Warn("PPU tried to read from the cartridge at an unexpected address " + Logger::DecmialToHex(address));
-    return 0;
-}
-
-void Mapper002::PpuWrite(uint16_t address, uint8_t data)
-{
-    if (address >= 0x0000 && address <= 0x1FFF)
-    {
-        m_chrRom[address] = data;
-        return;
-    }
-
-    Logger::GetInstance().Warn("PPU tried to write to the cartridge at an unexpected address " + Logger::DecmialToHex(address));
+    // Switchable 16 KB bank at 0x8000 - 0xBFFF and the last 16 KB bank fixed at 0xC000 - 0xFFFF
+    MapPrgRom(4, m_dynamicBank * 16 * 1024);
+    MapPrgRom(5, m_dynamicBank * 16 * 1024 + PRG_BANK_SIZE);
+    MapPrgRom(6, m_fixedBank * 16 * 1024);
+    MapPrgRom(7, m_fixedBank * 16 * 1024 + PRG_BANK_SIZE);
 }
@@ -0,0 +1,54 @@
+#include "mapper.h"
+
+uint8_t Mapper::CpuRead(uint16_t address)
+{
+    const uint8_t* bank = m_prgReadBanks[address / PRG_BANK_SIZE];
+    if (bank != nullptr) return bank[address & (PRG_BANK_SIZE - 1)];
+
+    Logger::GetInstance().Warn("CPU tried to read from the cartridge at an unexpected address " + Logger::DecmialToHex(address));
+    return 0;
+}
+
+uint8_t Mapper::PpuRead(uint16_t address)
+{
+    if (address >= 0x0000 && address <= 0x1FFF)
+        return m_chrBanks[address / CHR_BANK_SIZE][address & (CHR_BANK_SIZE - 1)];
+
+    Logger::GetInstance().Warn("PPU tried to read from the cartridge at an unexpected address " + Logger::DecmialToHex(address));
+    return 0;
+}
+
+void Mapper::PpuWrite(uint16_t address, uint8_t data)
+{
+    if (address >= 0x0000 && address <= 0x1FFF)
+    {
+        m_chrBanks[address / CHR_BANK_SIZE][address & (CHR_BANK_SIZE - 1)] = data;
+        return;
+    }
+
+    Logger::GetInstance().Warn("PPU tried to write to the cartridge at an unexpected address " + Logger::DecmialToHex(address));
+}
+
+void Mapper::MapPrgRom(size_t bank, size_t offset)
+{
+    uint8_t* memory = m_prgRom.empty() ? nullptr : &m_prgRom[offset % m_prgRom.size()];
+    if (m_prgReadBanks[bank] == memory && m_prgWriteBanks[bank] == nullptr) return;
+
+    m_prgReadBanks[bank] = memory;
+    m_prgWriteBanks[bank] = nullptr;
+    m_prgBanksSwitched = true;
+}
+
+void Mapper::MapPrgRam(size_t bank, uint8_t* ram)
+{
+    if (m_prgReadBanks[bank] == ram && m_prgWriteBanks[bank] == ram) return;
+
+    m_prgReadBanks[bank] = ram;
+    m_prgWriteBanks[bank] = ram;
+    m_prgBanksSwitched = true;
+}
+
+void Mapper::MapChr(size_t bank, size_t offset)
+{
+    m_chrBanks[bank] = &m_chrRom[offset % m_chrRom.size()];
+}
@@ -1,28 +1,64 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <vector>
 #include <optional>
 
+#include "../../debug/logger.h"
 #include "../mirror-mode.h"
 
 class Mapper
 {
 public:
+	static constexpr size_t PRG_BANK_SIZE = 0x2000;	// 8 KB windows over the CPU address space
+	static constexpr size_t PRG_BANK_COUNT = 0x10000 / PRG_BANK_SIZE;
+	static constexpr size_t CHR_BANK_SIZE = 0x0400;	// 1 KB windows over the pattern tables
+	static constexpr size_t CHR_BANK_COUNT = 0x2000 / CHR_BANK_SIZE;
+
+	using PrgBanks = std::array<uint8_t*, PRG_BANK_COUNT>;
+	using ChrBanks = std::array<uint8_t*, CHR_BANK_COUNT>;
+
 	Mapper(std::vector<uint8_t>& prgRom, std::vector<uint8_t>& chrRom) : m_prgRom(prgRom), m_chrRom(chrRom) {}
 	virtual ~Mapper() {}
 
-	virtual uint8_t CpuRead(uint16_t address) = 0;
+	// Reads go straight through the bank pointers, so mappers only need to handle writes
+	uint8_t CpuRead(uint16_t address);
 	virtual void CpuWrite(uint16_t address, uint8_t data) = 0;
 
-	virtual uint8_t PpuRead(uint16_t address) = 0;
-	virtual void PpuWrite(uint16_t address, uint8_t data) = 0;
+	uint8_t PpuRead(uint16_t address);
+	void PpuWrite(uint16_t address, uint8_t data);
 
 	virtual std::optional<MirrorMode> GetMirrorMode() { return {}; }
 
 	virtual bool PollIrqInterrupt() { return false; }
 
+	// The current bank layout, indexed by address / bank size. Unmapped banks are nullptr, and PRG banks
+	// that are not RAM have no write pointer. The arrays live as long as the mapper so buses can keep references.
+	const PrgBanks& GetPrgReadBanks() const { return m_prgReadBanks; }
+	const PrgBanks& GetPrgWriteBanks() const { return m_prgWriteBanks; }
+	const ChrBanks& GetChrBanks() const { return m_chrBanks; }
+
+	// Returns true once after a register write changes the PRG bank layout
+	bool PollPrgBankSwitch()
+	{
+		bool switched = m_prgBanksSwitched;
+		m_prgBanksSwitched = false;
+		return switched;
+	}
+
 protected:
 	std::vector<uint8_t>& m_prgRom;  // PRG ROM data
 	std::vector<uint8_t>& m_chrRom;  // CHR ROM data
+
+	// Point a bank at the given byte offset into PRG ROM, PRG RAM or CHR memory. ROM offsets wrap around the ROM size.
+	void MapPrgRom(size_t bank, size_t offset);
+	void MapPrgRam(size_t bank, uint8_t* ram);
+	void MapChr(size_t bank, size_t offset);
+
+private:
+	PrgBanks m_prgReadBanks{};
+	PrgBanks m_prgWriteBanks{};
+	ChrBanks m_chrBanks{};
+	bool m_prgBanksSwitched = false;
 };
\ No newline at end of file
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+struct Hash
+{
+    // 64-bit FNV-1a, used to fingerprint frame buffers for headless comparisons
+    static uint64_t Fnv1a64(const void* data, size_t length)
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        uint64_t hash = 0xCBF29CE484222325;
+
+        for (size_t i = 0; i < length; i++)
+        {
+            hash ^= bytes[i];
+            hash *= 0x100000001B3;
+        }
+
+        return hash;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <atomic>
+#include <array>
+#include <cstddef>
+#include <algorithm>
+
+// Wait-free ring buffer for one producer thread and one consumer thread. Each side only writes its own index,
+// and the release/acquire pairs make the elements written before an index update visible to the other side.
+template <typename T, size_t Capacity>
+class SpscRingBuffer
+{
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    // Producer only. Copies as many of the values as there is room for and returns how many that was.
+    size_t Push(const T* values, size_t count)
+    {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        size_t tail = m_tail.load(std::memory_order_acquire);
+        count = std::min(count, Capacity - (head - tail));
+
+        for (size_t i = 0; i < count; i++)
+            m_buffer[(head + i) & (Capacity - 1)] = values[i];
+
+        m_head.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    // Consumer only. Copies out up to count values and returns how many there were.
+    size_t Pop(T* values, size_t count)
+    {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        size_t head = m_head.load(std::memory_order_acquire);
+        count = std::min(count, head - tail);
+
+        for (size_t i = 0; i < count; i++)
+            values[i] = m_buffer[(tail + i) & (Capacity - 1)];
+
+        m_tail.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    // Only exact on the calling side; the other thread may have moved on by the time it is used
+    size_t Size() const { return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire); }
+
+private:
+    // The indices only ever increase (wrapping with size_t) and are masked when used, so full and empty differ.
+    // Each sits on its own cache line so the two threads do not keep stealing it from each other.
+    alignas(64) std::atomic<size_t> m_head = 0;
+    alignas(64) std::atomic<size_t> m_tail = 0;
+    alignas(64) std::array<T, Capacity> m_buffer{};
+};
\ No newline at end of file
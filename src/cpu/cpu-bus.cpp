@@ -3,6 +3,7 @@
 CpuBus::CpuBus()
 {
     m_memory.fill(0);
+    MapRamPages();
 }
 
 CpuBus::~CpuBus()
@@ -10,6 +11,26 @@ CpuBus::~CpuBus()
 }
 
 uint8_t CpuBus::Read(uint16_t address)
+{
+    const uint8_t* page = m_readPages[address >> 8];
+    if (page != nullptr) return page[address & 0xFF];
+
+    return ReadFromDevice(address);
+}
+
+void CpuBus::Write(uint16_t address, uint8_t data)
+{
+    uint8_t* page = m_writePages[address >> 8];
+    if (page != nullptr)
+    {
+        page[address & 0xFF] = data;
+        return;
+    }
+
+    WriteToDevice(address, data);
+}
+
+uint8_t CpuBus::ReadFromDevice(uint16_t address)
 {
     if (address >= 0x0000 && address <= 0x1FFF) // Read from RAM
     {
@@ -17,10 +38,12 @@ uint8_t CpuBus::Read(uint16_t address)
     }
     else if (address >= 0x2000 && address <= 0x3FFF) // Read from PPU registers
     {
+        CatchUpPPU();
         return m_ppu->Read(address & 0x2007);
     }
     else if (address == 0x4015) // Read from APU registers
     {
+        CatchUpAPU();
         return m_apu->Read(address);
     }
     else if (address == 0x4016) // Read controller 1 input
@@ -48,7 +71,7 @@ uint8_t CpuBus::Read(uint16_t address)
     return 0;
 }
 
-void CpuBus::Write(uint16_t address, uint8_t data)
+void CpuBus::WriteToDevice(uint16_t address, uint8_t data)
 {
     if (address >= 0x0000 && address <= 0x1FFF) // Write to RAM
     {
@@ -57,11 +80,13 @@ void CpuBus::Write(uint16_t address, uint8_t data)
     }
     else if (address >= 0x2000 && address <= 0x3FFF) // Write to PPU registers
     {
+        CatchUpPPU();
         m_ppu->Write(address & 0x2007, data);
         return;
     }
     else if ((address >= 0x4000 && address <= 0x4013) || address == 0x4015 || address == 0x4017) // Write to APU registers
     {
+        CatchUpAPU();
         m_apu->Write(address, data);
         return;
     }
@@ -69,6 +94,10 @@ void CpuBus::Write(uint16_t address, uint8_t data)
     {
         m_dmaPage = data;
         m_dmaReady = true;
+
+        // The CPU is halted from the next cycle
+        if (m_scheduler != nullptr)
+            m_scheduler->Schedule(Scheduler::Event::OamDma, m_scheduler->GetMasterCycle() + Scheduler::MASTER_CYCLES_PER_CPU_CYCLE);
         return;
     }
     else if (address == 0x4016) // Set controller polling mode
@@ -79,13 +108,22 @@ void CpuBus::Write(uint16_t address, uint8_t data)
     }
     else if (address >= 0x4020 && address <= 0xFFFF) // Write to cartridge
     {
+        // Mapper registers can switch CHR banks or mirroring, which must not affect dots that were already due
+        CatchUpPPU();
         m_cartridge->CpuWrite(address, data);
+        if (m_cartridge->PollPrgBankSwitch()) MapCartridgePages();
         return;
     }
 
     Logger::GetInstance().Warn("failed to write to CPU bus at address: " + Logger::DecmialToHex(address));
 }
 
+void CpuBus::ConnectCartridge(std::shared_ptr<Cartridge> cartridge)
+{
+    m_cartridge = cartridge;
+    MapCartridgePages();
+}
+
 void CpuBus::ConnectControllers(std::shared_ptr<uint8_t> controllerOneState, std::shared_ptr<uint8_t> controllerTwoState)
 {
     m_controllerOneState = controllerOneState;
@@ -100,6 +138,7 @@ bool CpuBus::TryDirectMemoryAccess(bool cycleIsOdd)
     {
         if (cycleIsOdd)
         {
+            CatchUpPPU();
             m_ppu->WriteByteToOAM(m_dmaAddress, m_dmaDataBuffer);
             m_dmaAddress++;
 
@@ -122,6 +161,67 @@ bool CpuBus::TryDirectMemoryAccess(bool cycleIsOdd)
     return true;
 }
 
+int CpuBus::TryBulkDirectMemoryAccess(bool cycleIsOdd)
+{
+    // Once bytes have started moving the transfer has to be finished the same way
+    if (!m_dmaReady || m_dmaInProgress) return 0;
+
+    // Pages without a direct mapping are registers, where reads can have side effects
+    const uint8_t* page = m_readPages[m_dmaPage];
+    if (page == nullptr) return 0;
+
+    // An alignment cycle (two if the transfer starts on an even cycle) followed by a read and write per byte
+    int cycles = (cycleIsOdd ? 1 : 2) + 256 * 2;
+
+    // The CPU is halted throughout, so the PPU is the only thing that could see OAM part way through
+    CatchUpPPU();
+    if (m_ppu->GetDotsUntilOamIsRead() < static_cast<uint32_t>(cycles) * 3) return 0;
+
+    m_ppu->WriteOAM(page);
+    m_dmaReady = false;
+    return cycles;
+}
+
+void CpuBus::MapRamPages()
+{
+    // The 2 KB of RAM is mirrored four times across 0x0000 - 0x1FFF
+    for (size_t page = 0x00; page < 0x20; page++)
+    {
+        m_readPages[page] = &m_memory[(page & 0x07) << 8];
+        m_writePages[page] = &m_memory[(page & 0x07) << 8];
+    }
+}
+
+void CpuBus::MapCartridgePages()
+{
+    if (m_cartridge == nullptr) return;
+
+    const Mapper::PrgBanks& readBanks = m_cartridge->GetPrgReadBanks();
+    const Mapper::PrgBanks& writeBanks = m_cartridge->GetPrgWriteBanks();
+
+    // Page 0x40 also holds the APU and controller registers so it always goes through ReadFromDevice/WriteToDevice
+    for (size_t page = 0x41; page < PAGE_COUNT; page++)
+    {
+        size_t bank = (page << 8) / Mapper::PRG_BANK_SIZE;
+        size_t offset = (page << 8) & (Mapper::PRG_BANK_SIZE - 1);
+        m_readPages[page] = readBanks[bank] != nullptr ? readBanks[bank] + offset : nullptr;
+        m_writePages[page] = writeBanks[bank] != nullptr ? writeBanks[bank] + offset : nullptr;
+    }
+}
+
+void CpuBus::CatchUpPPU()
+{
+    // The PPU is clocked lazily, so bring it up to the end of the current cycle before the CPU observes or changes it
+    if (m_scheduler != nullptr)
+        m_ppu->RunUntil((m_scheduler->GetMasterCycle() + Scheduler::MASTER_CYCLES_PER_CPU_CYCLE) / Scheduler::MASTER_CYCLES_PER_PPU_DOT);
+}
+
+void CpuBus::CatchUpAPU()
+{
+    // The APU is clocked lazily, so bring it up to and including the current cycle before the CPU touches it
+    if (m_scheduler != nullptr) m_apu->RunUntil(m_scheduler->GetCpuCycle() + 1);
+}
+
 void CpuBus::PollControllerState()
 {
     m_controllerOneShifter = *m_controllerOneState;
@@ -145,3 +245,6 @@ void CpuBus::PollControllerState()
         m_controllerTwoShifter &= ~0x0C;
     }
 }
+
+// The console CPU is compiled here so the compiler can inline CpuBus reads and writes into it
+template class BasicCPU<CpuBus>;
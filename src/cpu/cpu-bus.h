@@ -6,11 +6,13 @@
 
 #include "../debug/logger.h"
 #include "../interfaces/i-bus.h"
+#include "cpu.h"
 #include "../cartridge/cartridge.h"
 #include "../ppu/ppu.h"
 #include "../audio/apu.h"
+#include "../scheduler.h"
 
-class CpuBus : public IBus
+class CpuBus final : public IBus
 {
 public:
 	CpuBus();
@@ -20,20 +22,34 @@ public:
 	void Write(uint16_t address, uint8_t data) override;
 
 	void ConnectControllers(std::shared_ptr<uint8_t> controllerOneState, std::shared_ptr<uint8_t> controllerTwoState);
-	void ConnectCartridge(std::shared_ptr<Cartridge> cartridge) { m_cartridge = cartridge; }
+	void ConnectCartridge(std::shared_ptr<Cartridge> cartridge);
 	void ConnectPPU(std::shared_ptr<PPU> ppu) { m_ppu = ppu; }
 	void ConnectAPU(std::shared_ptr<APU> apu) { m_apu = apu; }
+	void ConnectScheduler(std::shared_ptr<Scheduler> scheduler) { m_scheduler = scheduler; }
 
 	bool TryDirectMemoryAccess(bool cycleIsOdd);
 
+	// Runs a pending OAM DMA in one go when nothing could tell it apart from the cycle by cycle transfer, returning the
+	// number of CPU cycles it stalls for. Returns 0 (and does nothing) when the transfer has to run cycle by cycle.
+	int TryBulkDirectMemoryAccess(bool cycleIsOdd);
+	bool DirectMemoryAccessPending() const { return m_dmaReady; }
+
 private:
+	static constexpr size_t PAGE_COUNT = 0x100;
+
 	std::array<uint8_t, 2048> m_memory;
 
+	// One entry per 256 byte page pointing straight at the memory behind it. Pages left as nullptr
+	// (I/O registers, mapper registers and unmapped space) are handled by ReadFromDevice/WriteToDevice.
+	std::array<const uint8_t*, PAGE_COUNT> m_readPages{};
+	std::array<uint8_t*, PAGE_COUNT> m_writePages{};
+
 	std::shared_ptr<uint8_t> m_controllerOneState;
     std::shared_ptr<uint8_t> m_controllerTwoState;
 	std::shared_ptr<Cartridge> m_cartridge;
 	std::shared_ptr<PPU> m_ppu;
 	std::shared_ptr<APU> m_apu;
+	std::shared_ptr<Scheduler> m_scheduler;
 
 	uint8_t m_controllerOneShifter = 0x00;
 	uint8_t m_controllerTwoShifter = 0x00;
@@ -47,4 +63,17 @@ private:
 	bool m_controllerPollingEnabled = false;
 
 	void PollControllerState();
-};
\ No newline at end of file
+	void CatchUpPPU();
+	void CatchUpAPU();
+
+	uint8_t ReadFromDevice(uint16_t address);
+	void WriteToDevice(uint16_t address, uint8_t data);
+
+	void MapRamPages();
+	void MapCartridgePages();
+};
+
+using CPU = BasicCPU<CpuBus>;
+
+// Compiled once in cpu-bus.cpp
+extern template class BasicCPU<CpuBus>;
\ No newline at end of file
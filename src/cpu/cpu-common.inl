@@ -0,0 +1,175 @@
+#pragma once
+
+template <typename Bus>
+BasicCPU<Bus>::BasicCPU(std::shared_ptr<Bus> bus) : m_bus(bus)
+{
+    if (m_bus == nullptr) throw std::runtime_error("CPU was created without a bus to connect to.");
+    Reset();
+}
+
+template <typename Bus>
+BasicCPU<Bus>::~BasicCPU() {}
+
+template <typename Bus>
+void BasicCPU<Bus>::Reset()
+{
+    m_program = &s_idleProgram;
+    m_programStep = 0;
+    m_injectedMicroOp = MicroOp::None;
+    m_interruptQueued = false;
+
+    reg_pc = Read(RESET_VECTOR);
+    reg_pc |= Read(RESET_VECTOR + 1) << 8;
+
+    reg_s -= 3;
+
+    SetFlag(Flag::U, true);
+    SetFlag(Flag::I, true);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::Clock()
+{
+    if (m_injectedMicroOp != MicroOp::None)
+    {
+        MicroOp microOp = m_injectedMicroOp;
+        m_injectedMicroOp = MicroOp::None;
+        ExecuteMicroOp(microOp);
+    }
+    else if (m_programStep < m_program->length)
+    {
+        ExecuteMicroOp(m_program->steps[m_programStep++]);
+    }
+    else if (m_interruptQueued)
+    {
+        // A polled interrupt starts as soon as the current instruction completes
+        m_interruptQueued = false;
+        m_program = &s_interruptProgram;
+        m_programStep = 1;
+        ExecuteMicroOp(m_program->steps[0]);
+    }
+    else
+    {
+        FetchNextInstruction();
+    }
+
+    if (RemainingMicroOps() == 1 && !m_interruptQueued && !m_interruptInProgress)
+        PollInterrupts();
+}
+
+template <typename Bus>
+int BasicCPU<Bus>::Step()
+{
+    int cycles = 0;
+
+    // Finish anything left part way through by Clock so the step starts on an instruction boundary
+    while (RemainingMicroOps() > 0 || m_interruptQueued)
+    {
+        Clock();
+        cycles++;
+    }
+
+    if (m_pendingNMI || (m_pendingIRQ && !GetFlag(Flag::I)))
+    {
+        PollInterrupts();
+        m_interruptQueued = false;
+        m_program = &s_interruptProgram;
+        m_programStep = 0;
+    }
+    else
+    {
+        FetchNextInstruction();
+        cycles++;
+    }
+
+    return cycles + RunProgramToCompletion();
+}
+
+template <typename Bus>
+int BasicCPU<Bus>::RunProgramToCompletion()
+{
+    int cycles = 0;
+    while (m_injectedMicroOp != MicroOp::None || m_programStep < m_program->length)
+    {
+        if (m_injectedMicroOp != MicroOp::None)
+        {
+            MicroOp microOp = m_injectedMicroOp;
+            m_injectedMicroOp = MicroOp::None;
+            ExecuteMicroOp(microOp);
+        }
+        else
+        {
+            ExecuteMicroOp(m_program->steps[m_programStep++]);
+        }
+
+        cycles++;
+    }
+
+    return cycles;
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::Interrupt(InterruptType type)
+{
+    switch (type)
+    {
+    case InterruptType::NMI:
+        m_pendingNMI = true;
+        m_mostRecentInterruptVector = NMI_VECTOR;
+        break;
+    case InterruptType::IRQ:
+        m_pendingIRQ = true;
+        m_mostRecentInterruptVector = IRQ_VECTOR;
+        break;
+    default:
+        break;
+    }
+}
+
+template <typename Bus>
+uint8_t BasicCPU<Bus>::GetFlag(Flag flag) const
+{
+    return ((reg_p & static_cast<uint8_t>(flag)) > 0) ? 1 : 0;
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::SetFlag(Flag flag, bool value)
+{
+    if (value) reg_p |= static_cast<uint8_t>(flag);
+    else reg_p &= ~static_cast<uint8_t>(flag);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::StackPush(uint8_t value)
+{
+    Write(STACK_BASE | reg_s, value);
+}
+
+template <typename Bus>
+uint8_t BasicCPU<Bus>::StackPop()
+{
+    return Read(STACK_BASE | reg_s);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::PollInterrupts()
+{
+    if (m_pendingNMI)
+    {
+        QueueInterrupt(InterruptType::NMI);
+        m_pendingNMI = false;
+        m_pendingIRQ = false;
+    }
+    else if (m_pendingIRQ && !GetFlag(Flag::I))
+    {
+        QueueInterrupt(InterruptType::IRQ);
+        m_pendingIRQ = false;
+    }
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::QueueInterrupt(InterruptType type)
+{
+    m_inProgressInterruptType = type;
+    m_interruptQueued = true;
+}
\ No newline at end of file
@@ -0,0 +1,324 @@
+#pragma once
+
+template <typename Bus>
+void BasicCPU<Bus>::ADC()
+{
+    uint16_t result = reg_a + m_operand + GetFlag(Flag::C);
+
+    SetFlag(Flag::C, result > 0xFF);
+    SetFlag(Flag::Z, (result & 0x00FF) == 0);
+    SetFlag(Flag::V, (result ^ reg_a) & (result ^ m_operand) & 0x80);
+    SetFlag(Flag::N, result & 0x80);
+
+    reg_a = static_cast<uint8_t>(result);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::SBC()
+{
+    uint16_t result = reg_a + ~m_operand + GetFlag(Flag::C);
+
+    SetFlag(Flag::C, !(result > 0xFF));
+    SetFlag(Flag::Z, (result & 0x00FF) == 0);
+    SetFlag(Flag::V, (result ^ reg_a) & (result ^ ~m_operand) & 0x80);
+    SetFlag(Flag::N, result & 0x80);
+
+    reg_a = static_cast<uint8_t>(result);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::INC()
+{
+    m_operand++;
+
+    SetFlag(Flag::Z, m_operand == 0);
+    SetFlag(Flag::N, m_operand & 0x80);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::DEC()
+{
+    m_operand--;
+
+    SetFlag(Flag::Z, m_operand == 0);
+    SetFlag(Flag::N, m_operand & 0x80);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::AND()
+{
+    reg_a &= m_operand;
+
+    SetFlag(Flag::Z, reg_a == 0);
+    SetFlag(Flag::N, reg_a & 0x80);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::ORA()
+{
+    reg_a |= m_operand;
+
+    SetFlag(Flag::Z, reg_a == 0);
+    SetFlag(Flag::N, reg_a & 0x80);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::EOR()
+{
+    reg_a ^= m_operand;
+
+    SetFlag(Flag::Z, reg_a == 0);
+    SetFlag(Flag::N, reg_a & 0x80);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::BIT()
+{
+    SetFlag(Flag::Z, (reg_a & m_operand) == 0);
+    SetFlag(Flag::V, m_operand & 0x40);
+    SetFlag(Flag::N, m_operand & 0x80);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::ASL()
+{
+    SetFlag(Flag::C, m_operand & 0x80);
+
+    m_operand = m_operand << 1;
+
+    SetFlag(Flag::Z, m_operand == 0);
+    SetFlag(Flag::N, m_operand & 0x80);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::LSR()
+{
+    SetFlag(Flag::C, m_operand & 0x01);
+
+    m_operand = m_operand >> 1;
+
+    SetFlag(Flag::Z, m_operand == 0);
+    SetFlag(Flag::N, m_operand & 0x80);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::ROL()
+{
+    uint8_t originalC = GetFlag(Flag::C);
+    SetFlag(Flag::C, m_operand & 0x80);
+
+    m_operand = (m_operand << 1) | originalC;
+
+    SetFlag(Flag::Z, m_operand == 0);
+    SetFlag(Flag::N, m_operand & 0x80);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::ROR()
+{
+    uint8_t originalC = GetFlag(Flag::C);
+    SetFlag(Flag::C, m_operand & 0x01);
+
+    m_operand = (m_operand >> 1) | (originalC << 7);
+
+    SetFlag(Flag::Z, m_operand == 0);
+    SetFlag(Flag::N, m_operand & 0x80);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::LDA()
+{
+    reg_a = m_operand;
+
+    SetFlag(Flag::Z, reg_a == 0);
+    SetFlag(Flag::N, reg_a & 0x80);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::LDX()
+{
+    reg_x = m_operand;
+
+    SetFlag(Flag::Z, reg_x == 0);
+    SetFlag(Flag::N, reg_x & 0x80);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::LDY()
+{
+    reg_y = m_operand;
+
+    SetFlag(Flag::Z, reg_y == 0);
+    SetFlag(Flag::N, reg_y & 0x80);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::STA()
+{
+    Write(m_targetAddress, reg_a);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::STX()
+{
+    Write(m_targetAddress, reg_x);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::STY()
+{
+    Write(m_targetAddress, reg_y);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::CMP()
+{
+    SetFlag(Flag::C, reg_a >= m_operand);
+    SetFlag(Flag::Z, reg_a == m_operand);
+    SetFlag(Flag::N, (reg_a - m_operand) & 0x80);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::CPX()
+{
+    SetFlag(Flag::C, reg_x >= m_operand);
+    SetFlag(Flag::Z, reg_x == m_operand);
+    SetFlag(Flag::N, (reg_x - m_operand) & 0x80);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::CPY()
+{
+    SetFlag(Flag::C, reg_y >= m_operand);
+    SetFlag(Flag::Z, reg_y == m_operand);
+    SetFlag(Flag::N, (reg_y - m_operand) & 0x80);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::TAX()
+{
+    reg_x = reg_a;
+
+    SetFlag(Flag::Z, reg_x == 0);
+    SetFlag(Flag::N, reg_x & 0x80);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::TXA()
+{
+    reg_a = reg_x;
+
+    SetFlag(Flag::Z, reg_a == 0);
+    SetFlag(Flag::N, reg_a & 0x80);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::TAY()
+{
+    reg_y = reg_a;
+
+    SetFlag(Flag::Z, reg_y == 0);
+    SetFlag(Flag::N, reg_y & 0x80);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::TYA()
+{
+    reg_a = reg_y;
+
+    SetFlag(Flag::Z, reg_a == 0);
+    SetFlag(Flag::N, reg_a & 0x80);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::TXS()
+{
+    reg_s = reg_x;
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::TSX()
+{
+    reg_x = reg_s;
+
+    SetFlag(Flag::Z, reg_x == 0);
+    SetFlag(Flag::N, reg_x & 0x80);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::INX()
+{
+    reg_x++;
+
+    SetFlag(Flag::Z, reg_x == 0);
+    SetFlag(Flag::N, reg_x & 0x80);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::DEX()
+{
+    reg_x--;
+
+    SetFlag(Flag::Z, reg_x == 0);
+    SetFlag(Flag::N, reg_x & 0x80);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::INY()
+{
+    reg_y++;
+
+    SetFlag(Flag::Z, reg_y == 0);
+    SetFlag(Flag::N, reg_y & 0x80);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::DEY()
+{
+    reg_y--;
+
+    SetFlag(Flag::Z, reg_y == 0);
+    SetFlag(Flag::N, reg_y & 0x80);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::SEC()
+{
+    SetFlag(Flag::C, true);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::CLC()
+{
+    SetFlag(Flag::C, false);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::SEI()
+{
+    SetFlag(Flag::I, true);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::CLI()
+{
+    SetFlag(Flag::I, false);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::SED()
+{
+    SetFlag(Flag::D, true);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::CLD()
+{
+    SetFlag(Flag::D, false);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::CLV()
+{
+    SetFlag(Flag::V, false);
+}
\ No newline at end of file
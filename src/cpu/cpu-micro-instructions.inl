@@ -0,0 +1,545 @@
+#pragma once
+
+template <typename Bus>
+void BasicCPU<Bus>::ExecuteMicroOp(MicroOp microOp)
+{
+    switch (microOp)
+    {
+    case MicroOp::PerformOperation:
+        (this->*m_program->operation)();
+        break;
+    case MicroOp::ReadProgramCounter:
+        ReadProgramCounter();
+        break;
+    case MicroOp::IncrementStackPointer:
+        IncrementStackPointer();
+        break;
+    case MicroOp::SetTargetAddressLowByteUsingPC:
+        SetTargetAddressLowByteUsingPC();
+        break;
+    case MicroOp::SetTargetAddressHighByteUsingPC:
+        SetTargetAddressHighByteUsingPC();
+        break;
+    case MicroOp::SetTargetAddressHighByteUsingXIndexedPC:
+        SetTargetAddressHighByteUsingXIndexedPC();
+        break;
+    case MicroOp::SetTargetAddressHighByteUsingYIndexedPC:
+        SetTargetAddressHighByteUsingYIndexedPC();
+        break;
+    case MicroOp::AddRegisterXToZeroPageTargetAddress:
+        AddRegisterXToZeroPageTargetAddress();
+        break;
+    case MicroOp::AddRegisterYToZeroPageTargetAddress:
+        AddRegisterYToZeroPageTargetAddress();
+        break;
+    case MicroOp::ReadOperandAtPCAndPerformOperation:
+        ReadOperandAtPCAndPerformOperation();
+        break;
+    case MicroOp::PerformOperationOnRegA:
+        PerformOperationOnRegA();
+        break;
+    case MicroOp::PerformInvalidTargetAddressRead:
+        PerformInvalidTargetAddressRead();
+        break;
+    case MicroOp::FetchHighByteForAbsoluteReadOnly:
+        FetchHighByteForAbsoluteReadOnly();
+        break;
+    case MicroOp::PerformOperationOnTargetAddress:
+        PerformOperationOnTargetAddress();
+        break;
+    case MicroOp::ReadOperandFromTargetAddress:
+        ReadOperandFromTargetAddress();
+        break;
+    case MicroOp::WriteOperandToTargetAddress:
+        WriteOperandToTargetAddress();
+        break;
+    case MicroOp::ReadOperandAtPCAndIncrementPC:
+        ReadOperandAtPCAndIncrementPC();
+        break;
+    case MicroOp::AddRegisterXToOperand:
+        AddRegisterXToOperand();
+        break;
+    case MicroOp::SetTargetAddressLowByteUsingOperand:
+        SetTargetAddressLowByteUsingOperand();
+        break;
+    case MicroOp::SetTargetAddressHighByteUsingOperand:
+        SetTargetAddressHighByteUsingOperand();
+        break;
+    case MicroOp::FetchHighByteForIndirectIndexedReadOnly:
+        FetchHighByteForIndirectIndexedReadOnly();
+        break;
+    case MicroOp::SetTargetAddressHighByteUsingYIndexedOperand:
+        SetTargetAddressHighByteUsingYIndexedOperand();
+        break;
+    case MicroOp::CheckBranchCondition:
+        CheckBranchCondition();
+        break;
+    case MicroOp::PerformBranch:
+        PerformBranch();
+        break;
+    case MicroOp::BlankMicroInstruction:
+        BlankMicroInstruction();
+        break;
+    case MicroOp::PopStatusOffTheStackAndIncrementStackPointer:
+        PopStatusOffTheStackAndIncrementStackPointer();
+        break;
+    case MicroOp::PopPCLowByteOffTheStackAndIncrementStackPointer:
+        PopPCLowByteOffTheStackAndIncrementStackPointer();
+        break;
+    case MicroOp::PopPCHighByteOffTheStack:
+        PopPCHighByteOffTheStack();
+        break;
+    case MicroOp::IncrementProgramCounter:
+        IncrementProgramCounter();
+        break;
+    case MicroOp::PopStatusOffTheStack:
+        PopStatusOffTheStack();
+        break;
+    case MicroOp::PushAccumulatorToTheStack:
+        PushAccumulatorToTheStack();
+        break;
+    case MicroOp::PushStatusToTheStackWithBSet:
+        PushStatusToTheStackWithBSet();
+        break;
+    case MicroOp::PopAccumulatorFromTheStackAndSetFlags:
+        PopAccumulatorFromTheStackAndSetFlags();
+        break;
+    case MicroOp::ReadFromTheStackPointer:
+        ReadFromTheStackPointer();
+        break;
+    case MicroOp::PushPCHighByteToTheStack:
+        PushPCHighByteToTheStack();
+        break;
+    case MicroOp::PushPCLowByteToTheStack:
+        PushPCLowByteToTheStack();
+        break;
+    case MicroOp::JumpToSubroutineFinal:
+        JumpToSubroutineFinal();
+        break;
+    case MicroOp::JumpAbsoluteFinal:
+        JumpAbsoluteFinal();
+        break;
+    case MicroOp::JumpIndirectFinal:
+        JumpIndirectFinal();
+        break;
+    case MicroOp::PushStatusAndDecideFinalInterruptVector:
+        PushStatusAndDecideFinalInterruptVector();
+        break;
+    case MicroOp::SetPCLowByteAndSetInterruptFlag:
+        SetPCLowByteAndSetInterruptFlag();
+        break;
+    case MicroOp::SetPCHighByteAndClearInterruptInProgress:
+        SetPCHighByteAndClearInterruptInProgress();
+        break;
+    case MicroOp::SetInterruptInProgress:
+        SetInterruptInProgress();
+        break;
+    case MicroOp::SetInterruptInProgressAndIncrementPC:
+        SetInterruptInProgressAndIncrementPC();
+        break;
+    case MicroOp::None:
+    default:
+        throw std::runtime_error("Unexpected micro instruction.");
+    }
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::ReadProgramCounter()
+{
+    Read(reg_pc);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::IncrementStackPointer()
+{
+    reg_s++;
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::SetTargetAddressLowByteUsingPC()
+{
+    m_targetAddress = Read(reg_pc++);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::SetTargetAddressHighByteUsingPC()
+{
+    m_targetAddress |= Read(reg_pc++) << 8;
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::SetTargetAddressHighByteUsingXIndexedPC()
+{
+    uint8_t originalPage = Read(reg_pc++);
+    m_targetAddress |= originalPage << 8;
+    m_targetAddress += reg_x;
+
+    // Force a read at a possibly invalid address
+    if (originalPage == m_targetAddress >> 8)
+        InjectMicroOp(MicroOp::ReadOperandFromTargetAddress);
+    else
+        InjectMicroOp(MicroOp::PerformInvalidTargetAddressRead);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::SetTargetAddressHighByteUsingYIndexedPC()
+{
+    uint8_t originalPage = Read(reg_pc++);
+    m_targetAddress |= originalPage << 8;
+    m_targetAddress += reg_y;
+
+    // Force a read at a possibly invalid address
+    if (originalPage == m_targetAddress >> 8)
+        InjectMicroOp(MicroOp::ReadOperandFromTargetAddress);
+    else
+        InjectMicroOp(MicroOp::PerformInvalidTargetAddressRead);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::AddRegisterXToZeroPageTargetAddress()
+{
+    m_targetAddress += reg_x;
+    m_targetAddress &= 0x00FF;
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::AddRegisterYToZeroPageTargetAddress()
+{
+    m_targetAddress += reg_y;
+    m_targetAddress &= 0x00FF;
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::ReadOperandAtPCAndPerformOperation()
+{
+    m_operand = Read(reg_pc++);
+    (this->*m_program->operation)();
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::PerformOperationOnRegA()
+{
+    m_operand = reg_a;
+    (this->*m_program->operation)();
+    reg_a = m_operand;
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::PerformInvalidTargetAddressRead()
+{
+    Read(m_targetAddress - 0x100);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::FetchHighByteForAbsoluteReadOnly()
+{
+    uint8_t originalPage = Read(reg_pc++);
+    m_targetAddress |= originalPage << 8;
+
+    switch (m_program->indexType)
+    {
+    case IndexType::None:
+        return; // No need to continue
+    case IndexType::X:
+        m_targetAddress += reg_x;
+        break;
+    case IndexType::Y:
+        m_targetAddress += reg_y;
+        break;
+    default:
+        throw std::runtime_error("Unexpected address index type.");
+    }
+
+    uint8_t newPage = m_targetAddress >> 8;
+    if (originalPage != newPage)
+    {
+        InjectMicroOp(MicroOp::PerformInvalidTargetAddressRead);
+    }
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::PerformOperationOnTargetAddress()
+{
+    m_operand = Read(m_targetAddress);
+    (this->*m_program->operation)();
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::ReadOperandFromTargetAddress()
+{
+    m_operand = Read(m_targetAddress);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::WriteOperandToTargetAddress()
+{
+    Write(m_targetAddress, m_operand);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::ReadOperandAtPCAndIncrementPC()
+{
+    m_operand = Read(reg_pc++);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::AddRegisterXToOperand()
+{
+    m_operand += reg_x;
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::SetTargetAddressLowByteUsingOperand()
+{
+    m_targetAddress = Read(m_operand++);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::SetTargetAddressHighByteUsingOperand()
+{
+    m_targetAddress |= Read(m_operand) << 8;
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::FetchHighByteForIndirectIndexedReadOnly()
+{
+    uint8_t originalPage = Read(m_operand);
+
+    m_targetAddress |= originalPage << 8;
+    m_targetAddress += reg_y;
+
+    uint8_t newPage = m_targetAddress >> 8;
+    if (originalPage != newPage)
+    {
+        InjectMicroOp(MicroOp::PerformInvalidTargetAddressRead);
+    }
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::SetTargetAddressHighByteUsingYIndexedOperand()
+{
+    uint8_t originalPage = Read(m_operand);
+    m_targetAddress |= originalPage << 8;
+    m_targetAddress += reg_y;
+
+    // Force a read at a possibly invalid address
+    if (originalPage == m_targetAddress >> 8)
+        InjectMicroOp(MicroOp::ReadOperandFromTargetAddress);
+    else
+        InjectMicroOp(MicroOp::PerformInvalidTargetAddressRead);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::CheckBranchCondition()
+{
+    m_operand = Read(reg_pc++);
+    if (!(this->*m_program->branchTest)()) return;
+
+    InjectMicroOp(MicroOp::PerformBranch);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::PerformBranch()
+{
+    uint8_t originalPage = reg_pc >> 8;
+    reg_pc = reg_pc + static_cast<int8_t>(m_operand);
+
+    // Add a blank cycle when a page is crossed
+    if (originalPage != (reg_pc >> 8))
+        InjectMicroOp(MicroOp::BlankMicroInstruction);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::BlankMicroInstruction() {}
+
+template <typename Bus>
+void BasicCPU<Bus>::PopStatusOffTheStackAndIncrementStackPointer()
+{
+    reg_p = StackPop();
+    reg_s++;
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::PopPCLowByteOffTheStackAndIncrementStackPointer()
+{
+    reg_pc = StackPop();
+    reg_s++;
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::PopPCHighByteOffTheStack()
+{
+    reg_pc |= StackPop() << 8;
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::IncrementProgramCounter()
+{
+    reg_pc++;
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::PopStatusOffTheStack()
+{
+    reg_p = StackPop();
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::PushAccumulatorToTheStack()
+{
+    StackPush(reg_a);
+    reg_s--;
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::PushStatusToTheStackWithBSet()
+{
+    StackPush(reg_p | static_cast<uint8_t>(Flag::B));
+    reg_s--;
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::PopAccumulatorFromTheStackAndSetFlags()
+{
+    reg_a = StackPop();
+    SetFlag(Flag::Z, reg_a == 0);
+    SetFlag(Flag::N, reg_a & 0x80);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::ReadFromTheStackPointer()
+{
+    Read(0x100 + reg_s);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::PushPCHighByteToTheStack()
+{
+    StackPush(reg_pc >> 8);
+    reg_s--;
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::PushPCLowByteToTheStack()
+{
+    StackPush(static_cast<uint8_t>(reg_pc));
+    reg_s--;
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::JumpToSubroutineFinal()
+{
+    m_targetAddress |= Read(reg_pc) << 8;
+    reg_pc = m_targetAddress;
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::JumpAbsoluteFinal()
+{
+    uint8_t pch = Read(reg_pc);
+    reg_pc = m_operand;
+    reg_pc |= pch << 8;
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::JumpIndirectFinal()
+{
+    uint16_t pchAddress;
+    if (static_cast<uint8_t>(m_targetAddress) == 0xFF)
+        pchAddress = m_targetAddress & 0xFF00;
+    else
+        pchAddress = m_targetAddress + 1;
+
+    reg_pc = m_operand;
+    reg_pc |= Read(pchAddress) << 8;
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::PushStatusAndDecideFinalInterruptVector()
+{
+    // Allows NMI interrupts to hijack the BRK/IRQ interrupt vector
+    if (m_inProgressInterruptType == InterruptType::NMI) m_targetAddress = NMI_VECTOR;
+    else m_targetAddress = m_mostRecentInterruptVector;
+
+    if (m_inProgressInterruptType == InterruptType::BRK)
+        StackPush(reg_p | static_cast<uint8_t>(Flag::B));
+    else
+        StackPush(reg_p & ~static_cast<uint8_t>(Flag::B));
+
+    reg_s--;
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::SetPCLowByteAndSetInterruptFlag()
+{
+    reg_pc = Read(m_targetAddress);
+    SetFlag(Flag::I, true);
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::SetPCHighByteAndClearInterruptInProgress()
+{
+    reg_pc |= Read(m_targetAddress + 1) << 8;
+    m_interruptInProgress = false;
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::SetInterruptInProgress()
+{
+    m_interruptInProgress = true;
+}
+
+template <typename Bus>
+void BasicCPU<Bus>::SetInterruptInProgressAndIncrementPC()
+{
+    m_interruptInProgress = true;
+    reg_pc++;
+}
+
+template <typename Bus>
+bool BasicCPU<Bus>::PlusTest() const
+{
+    return GetFlag(Flag::N) == 0;
+}
+
+template <typename Bus>
+bool BasicCPU<Bus>::MinusTest() const
+{
+    return GetFlag(Flag::N) == 1;
+}
+
+template <typename Bus>
+bool BasicCPU<Bus>::OverflowClearTest() const
+{
+    return GetFlag(Flag::V) == 0;
+}
+
+template <typename Bus>
+bool BasicCPU<Bus>::OverflowSetTest() const
+{
+    return GetFlag(Flag::V) == 1;
+}
+
+template <typename Bus>
+bool BasicCPU<Bus>::CarryClearTest() const
+{
+    return GetFlag(Flag::C) == 0;
+}
+
+template <typename Bus>
+bool BasicCPU<Bus>::CarrySetTest() const
+{
+    return GetFlag(Flag::C) == 1;
+}
+
+template <typename Bus>
+bool BasicCPU<Bus>::NotEqualTest() const
+{
+    return GetFlag(Flag::Z) == 0;
+}
+
+template <typename Bus>
+bool BasicCPU<Bus>::EqualTest() const
+{
+    return GetFlag(Flag::Z) == 1;
+}
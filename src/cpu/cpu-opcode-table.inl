@@ -0,0 +1,591 @@
+#pragma once
+
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::MakeProgram(std::initializer_list<MicroOp> steps, Operation operation, IndexType indexType)
+{
+    if (steps.size() > InstructionProgram::MAX_STEPS)
+        throw std::runtime_error("Instruction program has too many steps.");
+
+    InstructionProgram program;
+    for (MicroOp step : steps) program.steps[program.length++] = step;
+    program.isLegal = true;
+    program.indexType = indexType;
+    program.operation = operation;
+    return program;
+}
+
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::ImmediateReadOnly(Operation operation)
+{
+    return MakeProgram({ MicroOp::ReadOperandAtPCAndPerformOperation }, operation);
+}
+
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::AccumulatorReadModifyWrite(Operation operation)
+{
+    return MakeProgram({ MicroOp::PerformOperationOnRegA }, operation);
+}
+
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::AbsoluteReadOnly(Operation operation, IndexType indexType)
+{
+    return MakeProgram({
+        MicroOp::SetTargetAddressLowByteUsingPC,
+        MicroOp::FetchHighByteForAbsoluteReadOnly,
+        MicroOp::PerformOperationOnTargetAddress,
+    }, operation, indexType);
+}
+
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::AbsoluteReadModifyWrite(Operation operation, IndexType indexType)
+{
+    MicroOp fetchHighByte;
+    switch (indexType)
+    {
+    case IndexType::None:
+        fetchHighByte = MicroOp::SetTargetAddressHighByteUsingPC;
+        break;
+    case IndexType::X:
+        fetchHighByte = MicroOp::SetTargetAddressHighByteUsingXIndexedPC;
+        break;
+    case IndexType::Y: // Unexpected
+    default:
+        throw std::runtime_error("Unexpected address index type.");
+    }
+
+    return MakeProgram({
+        MicroOp::SetTargetAddressLowByteUsingPC,
+        fetchHighByte,
+        MicroOp::ReadOperandFromTargetAddress,
+        MicroOp::PerformOperation,
+        MicroOp::WriteOperandToTargetAddress,
+    }, operation, indexType);
+}
+
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::AbsoluteWriteOnly(Operation operation, IndexType indexType)
+{
+    MicroOp fetchHighByte;
+    switch (indexType)
+    {
+    case IndexType::None:
+        fetchHighByte = MicroOp::SetTargetAddressHighByteUsingPC;
+        break;
+    case IndexType::X:
+        fetchHighByte = MicroOp::SetTargetAddressHighByteUsingXIndexedPC;
+        break;
+    case IndexType::Y:
+        fetchHighByte = MicroOp::SetTargetAddressHighByteUsingYIndexedPC;
+        break;
+    default:
+        throw std::runtime_error("Unexpected address index type.");
+    }
+
+    return MakeProgram({
+        MicroOp::SetTargetAddressLowByteUsingPC,
+        fetchHighByte,
+        MicroOp::PerformOperation,
+    }, operation, indexType);
+}
+
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::ZeroPageReadOnly(Operation operation, IndexType indexType)
+{
+    switch (indexType)
+    {
+    case IndexType::None:
+        return MakeProgram({
+            MicroOp::SetTargetAddressLowByteUsingPC,
+            MicroOp::PerformOperationOnTargetAddress,
+        }, operation, indexType);
+    case IndexType::X:
+        return MakeProgram({
+            MicroOp::SetTargetAddressLowByteUsingPC,
+            MicroOp::AddRegisterXToZeroPageTargetAddress,
+            MicroOp::PerformOperationOnTargetAddress,
+        }, operation, indexType);
+    case IndexType::Y:
+        return MakeProgram({
+            MicroOp::SetTargetAddressLowByteUsingPC,
+            MicroOp::AddRegisterYToZeroPageTargetAddress,
+            MicroOp::PerformOperationOnTargetAddress,
+        }, operation, indexType);
+    default:
+        throw std::runtime_error("Unexpected address index type.");
+    }
+}
+
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::ZeroPageReadModifyWrite(Operation operation, IndexType indexType)
+{
+    switch (indexType)
+    {
+    case IndexType::None:
+        return MakeProgram({
+            MicroOp::SetTargetAddressLowByteUsingPC,
+            MicroOp::ReadOperandFromTargetAddress,
+            MicroOp::PerformOperation,
+            MicroOp::WriteOperandToTargetAddress,
+        }, operation, indexType);
+    case IndexType::X:
+        return MakeProgram({
+            MicroOp::SetTargetAddressLowByteUsingPC,
+            MicroOp::AddRegisterXToZeroPageTargetAddress,
+            MicroOp::ReadOperandFromTargetAddress,
+            MicroOp::PerformOperation,
+            MicroOp::WriteOperandToTargetAddress,
+        }, operation, indexType);
+    case IndexType::Y: // Unexpected
+    default:
+        throw std::runtime_error("Unexpected address index type.");
+    }
+}
+
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::ZeroPageWriteOnly(Operation operation, IndexType indexType)
+{
+    switch (indexType)
+    {
+    case IndexType::None:
+        return MakeProgram({
+            MicroOp::SetTargetAddressLowByteUsingPC,
+            MicroOp::PerformOperation,
+        }, operation, indexType);
+    case IndexType::X:
+        return MakeProgram({
+            MicroOp::SetTargetAddressLowByteUsingPC,
+            MicroOp::AddRegisterXToZeroPageTargetAddress,
+            MicroOp::PerformOperation,
+        }, operation, indexType);
+    case IndexType::Y:
+        return MakeProgram({
+            MicroOp::SetTargetAddressLowByteUsingPC,
+            MicroOp::AddRegisterYToZeroPageTargetAddress,
+            MicroOp::PerformOperation,
+        }, operation, indexType);
+    default:
+        throw std::runtime_error("Unexpected address index type.");
+    }
+}
+
+// The indirect modes temporarily use the operand variable to store a pointer
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::IndexedIndirectReadOnly(Operation operation)
+{
+    return MakeProgram({
+        MicroOp::ReadOperandAtPCAndIncrementPC,
+        MicroOp::AddRegisterXToOperand,
+        MicroOp::SetTargetAddressLowByteUsingOperand,
+        MicroOp::SetTargetAddressHighByteUsingOperand,
+        MicroOp::PerformOperationOnTargetAddress,
+    }, operation);
+}
+
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::IndexedIndirectReadModifyWrite(Operation operation)
+{
+    return MakeProgram({
+        MicroOp::ReadOperandAtPCAndIncrementPC,
+        MicroOp::AddRegisterXToOperand,
+        MicroOp::SetTargetAddressLowByteUsingOperand,
+        MicroOp::SetTargetAddressHighByteUsingOperand,
+        MicroOp::ReadOperandFromTargetAddress,
+        MicroOp::PerformOperation,
+        MicroOp::WriteOperandToTargetAddress,
+    }, operation);
+}
+
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::IndexedIndirectWriteOnly(Operation operation)
+{
+    return MakeProgram({
+        MicroOp::ReadOperandAtPCAndIncrementPC,
+        MicroOp::AddRegisterXToOperand,
+        MicroOp::SetTargetAddressLowByteUsingOperand,
+        MicroOp::SetTargetAddressHighByteUsingOperand,
+        MicroOp::PerformOperation,
+    }, operation);
+}
+
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::IndirectIndexedReadOnly(Operation operation)
+{
+    return MakeProgram({
+        MicroOp::ReadOperandAtPCAndIncrementPC,
+        MicroOp::SetTargetAddressLowByteUsingOperand,
+        MicroOp::FetchHighByteForIndirectIndexedReadOnly,
+        MicroOp::PerformOperationOnTargetAddress,
+    }, operation);
+}
+
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::IndirectIndexedReadModifyWrite(Operation operation)
+{
+    return MakeProgram({
+        MicroOp::ReadOperandAtPCAndIncrementPC,
+        MicroOp::SetTargetAddressLowByteUsingOperand,
+        MicroOp::SetTargetAddressHighByteUsingYIndexedOperand,
+        MicroOp::ReadOperandFromTargetAddress,
+        MicroOp::PerformOperation,
+        MicroOp::WriteOperandToTargetAddress,
+    }, operation);
+}
+
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::IndirectIndexedWriteOnly(Operation operation)
+{
+    return MakeProgram({
+        MicroOp::ReadOperandAtPCAndIncrementPC,
+        MicroOp::SetTargetAddressLowByteUsingOperand,
+        MicroOp::SetTargetAddressHighByteUsingYIndexedOperand,
+        MicroOp::PerformOperation,
+    }, operation);
+}
+
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::Branch(BranchTest branchTest)
+{
+    InstructionProgram program = MakeProgram({ MicroOp::CheckBranchCondition });
+    program.branchTest = branchTest;
+    return program;
+}
+
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::Implied(Operation operation)
+{
+    return MakeProgram({ MicroOp::PerformOperation }, operation);
+}
+
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::RTI()
+{
+    return MakeProgram({
+        MicroOp::ReadProgramCounter,
+        MicroOp::IncrementStackPointer,
+        MicroOp::PopStatusOffTheStackAndIncrementStackPointer,
+        MicroOp::PopPCLowByteOffTheStackAndIncrementStackPointer,
+        MicroOp::PopPCHighByteOffTheStack,
+    });
+}
+
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::RTS()
+{
+    return MakeProgram({
+        MicroOp::ReadProgramCounter,
+        MicroOp::IncrementStackPointer,
+        MicroOp::PopPCLowByteOffTheStackAndIncrementStackPointer,
+        MicroOp::PopPCHighByteOffTheStack,
+        MicroOp::IncrementProgramCounter,
+    });
+}
+
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::PHA()
+{
+    return MakeProgram({ MicroOp::ReadProgramCounter, MicroOp::PushAccumulatorToTheStack });
+}
+
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::PHP()
+{
+    return MakeProgram({ MicroOp::ReadProgramCounter, MicroOp::PushStatusToTheStackWithBSet });
+}
+
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::PLA()
+{
+    return MakeProgram({
+        MicroOp::ReadProgramCounter,
+        MicroOp::IncrementStackPointer,
+        MicroOp::PopAccumulatorFromTheStackAndSetFlags,
+    });
+}
+
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::PLP()
+{
+    return MakeProgram({
+        MicroOp::ReadProgramCounter,
+        MicroOp::IncrementStackPointer,
+        MicroOp::PopStatusOffTheStack,
+    });
+}
+
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::JSR()
+{
+    return MakeProgram({
+        MicroOp::SetTargetAddressLowByteUsingPC,
+        MicroOp::ReadFromTheStackPointer,
+        MicroOp::PushPCHighByteToTheStack,
+        MicroOp::PushPCLowByteToTheStack,
+        MicroOp::JumpToSubroutineFinal,
+    });
+}
+
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::BRK()
+{
+    return MakeProgram({
+        MicroOp::SetInterruptInProgressAndIncrementPC,
+        MicroOp::PushPCHighByteToTheStack,
+        MicroOp::PushPCLowByteToTheStack,
+        MicroOp::PushStatusAndDecideFinalInterruptVector,
+        MicroOp::SetPCLowByteAndSetInterruptFlag,
+        MicroOp::SetPCHighByteAndClearInterruptInProgress,
+    });
+}
+
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::NOP()
+{
+    return MakeProgram({ MicroOp::BlankMicroInstruction });
+}
+
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::JMP_Absolute()
+{
+    return MakeProgram({ MicroOp::ReadOperandAtPCAndIncrementPC, MicroOp::JumpAbsoluteFinal });
+}
+
+template <typename Bus>
+constexpr typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::JMP_Indirect()
+{
+    return MakeProgram({
+        MicroOp::SetTargetAddressLowByteUsingPC,
+        MicroOp::SetTargetAddressHighByteUsingPC,
+        MicroOp::ReadOperandFromTargetAddress,
+        MicroOp::JumpIndirectFinal,
+    });
+}
+
+template <typename Bus>
+constexpr std::array<typename BasicCPU<Bus>::InstructionProgram, 256> BasicCPU<Bus>::BuildInstructionTable()
+{
+    // Opcodes that are not assigned below are illegal and have an empty program
+    std::array<InstructionProgram, 256> table{};
+
+    // Opcodes 0x00 to 0x0F
+    table[0x00] = BRK(); // BRK
+    table[0x01] = IndexedIndirectReadOnly(&BasicCPU::ORA); // ORA (Indirect,X)
+    table[0x05] = ZeroPageReadOnly(&BasicCPU::ORA, IndexType::None); // ORA Zero Page
+    table[0x06] = ZeroPageReadModifyWrite(&BasicCPU::ASL, IndexType::None); // ASL Zero Page
+    table[0x08] = PHP(); // PHP
+    table[0x09] = ImmediateReadOnly(&BasicCPU::ORA); // ORA Immediate
+    table[0x0A] = AccumulatorReadModifyWrite(&BasicCPU::ASL); // ASL Accumulator
+    table[0x0D] = AbsoluteReadOnly(&BasicCPU::ORA, IndexType::None); // ORA Absolute
+    table[0x0E] = AbsoluteReadModifyWrite(&BasicCPU::ASL, IndexType::None); // ASL Absolute
+
+    // Opcodes 0x10 to 0x1F
+    table[0x10] = Branch(&BasicCPU::PlusTest); // BPL
+    table[0x11] = IndirectIndexedReadOnly(&BasicCPU::ORA); // ORA (Indirect),Y
+    table[0x15] = ZeroPageReadOnly(&BasicCPU::ORA, IndexType::X); // ORA Zero Page,X
+    table[0x16] = ZeroPageReadModifyWrite(&BasicCPU::ASL, IndexType::X); // ASL Zero Page,X
+    table[0x18] = Implied(&BasicCPU::CLC); // CLC
+    table[0x19] = AbsoluteReadOnly(&BasicCPU::ORA, IndexType::Y); // ORA Absolute,Y
+    table[0x1D] = AbsoluteReadOnly(&BasicCPU::ORA, IndexType::X); // ORA Absolute,X
+    table[0x1E] = AbsoluteReadModifyWrite(&BasicCPU::ASL, IndexType::X); // ASL Absolute,X
+
+    // Opcodes 0x20 to 0x2F
+    table[0x20] = JSR(); // JSR
+    table[0x21] = IndexedIndirectReadOnly(&BasicCPU::AND); // AND (Indirect,X)
+    table[0x24] = ZeroPageReadOnly(&BasicCPU::BIT, IndexType::None); // BIT Zero Page
+    table[0x25] = ZeroPageReadOnly(&BasicCPU::AND, IndexType::None); // AND Zero Page
+    table[0x26] = ZeroPageReadModifyWrite(&BasicCPU::ROL, IndexType::None); // ROL Zero Page
+    table[0x28] = PLP(); // PLP
+    table[0x29] = ImmediateReadOnly(&BasicCPU::AND); // AND Immediate
+    table[0x2A] = AccumulatorReadModifyWrite(&BasicCPU::ROL); // ROL Accumulator
+    table[0x2C] = AbsoluteReadOnly(&BasicCPU::BIT, IndexType::None); // BIT Absolute
+    table[0x2D] = AbsoluteReadOnly(&BasicCPU::AND, IndexType::None); // AND Absolute
+    table[0x2E] = AbsoluteReadModifyWrite(&BasicCPU::ROL, IndexType::None); // ROL Absolute
+
+    // Opcodes 0x30 to 0x3F
+    table[0x30] = Branch(&BasicCPU::MinusTest); // BMI
+    table[0x31] = IndirectIndexedReadOnly(&BasicCPU::AND); // AND (Indirect),Y
+    table[0x35] = ZeroPageReadOnly(&BasicCPU::AND, IndexType::X); // AND Zero Page,X
+    table[0x36] = ZeroPageReadModifyWrite(&BasicCPU::ROL, IndexType::X); // ROL Zero Page,X
+    table[0x38] = Implied(&BasicCPU::SEC); // SEC
+    table[0x39] = AbsoluteReadOnly(&BasicCPU::AND, IndexType::Y); // AND Absolute,Y
+    table[0x3D] = AbsoluteReadOnly(&BasicCPU::AND, IndexType::X); // AND Absolute,X
+    table[0x3E] = AbsoluteReadModifyWrite(&BasicCPU::ROL, IndexType::X); // ROL Absolute,X
+
+    // Opcodes 0x40 to 0x4F
+    table[0x40] = RTI(); // RTI
+    table[0x41] = IndexedIndirectReadOnly(&BasicCPU::EOR); // EOR (Indirect,X)
+    table[0x45] = ZeroPageReadOnly(&BasicCPU::EOR, IndexType::None); // EOR Zero Page
+    table[0x46] = ZeroPageReadModifyWrite(&BasicCPU::LSR, IndexType::None); // LSR Zero Page
+    table[0x48] = PHA(); // PHA
+    table[0x49] = ImmediateReadOnly(&BasicCPU::EOR); // EOR Immediate
+    table[0x4A] = AccumulatorReadModifyWrite(&BasicCPU::LSR); // LSR Accumulator
+    table[0x4C] = JMP_Absolute(); // JMP Absolute
+    table[0x4D] = AbsoluteReadOnly(&BasicCPU::EOR, IndexType::None); // EOR Absolute
+    table[0x4E] = AbsoluteReadModifyWrite(&BasicCPU::LSR, IndexType::None); // LSR Absolute
+
+    // Opcodes 0x50 to 0x5F
+    table[0x50] = Branch(&BasicCPU::OverflowClearTest); // BVC
+    table[0x51] = IndirectIndexedReadOnly(&BasicCPU::EOR); // EOR (Indirect),Y
+    table[0x55] = ZeroPageReadOnly(&BasicCPU::EOR, IndexType::X); // EOR Zero Page,X
+    table[0x56] = ZeroPageReadModifyWrite(&BasicCPU::LSR, IndexType::X); // LSR Zero Page,X
+    table[0x58] = Implied(&BasicCPU::CLI); // CLI
+    table[0x59] = AbsoluteReadOnly(&BasicCPU::EOR, IndexType::Y); // EOR Absolute,Y
+    table[0x5D] = AbsoluteReadOnly(&BasicCPU::EOR, IndexType::X); // EOR Absolute,X
+    table[0x5E] = AbsoluteReadModifyWrite(&BasicCPU::LSR, IndexType::X); // LSR Absolute,X
+
+    // Opcodes 0x60 to 0x6F
+    table[0x60] = RTS(); // RTS
+    table[0x61] = IndexedIndirectReadOnly(&BasicCPU::ADC); // ADC (Indirect,X)
+    table[0x65] = ZeroPageReadOnly(&BasicCPU::ADC, IndexType::None); // ADC Zero Page
+    table[0x66] = ZeroPageReadModifyWrite(&BasicCPU::ROR, IndexType::None); // ROR Zero Page
+    table[0x68] = PLA(); // PLA
+    table[0x69] = ImmediateReadOnly(&BasicCPU::ADC); // ADC Immediate
+    table[0x6A] = AccumulatorReadModifyWrite(&BasicCPU::ROR); // ROR Accumulator
+    table[0x6C] = JMP_Indirect(); // JMP (Indirect)
+    table[0x6D] = AbsoluteReadOnly(&BasicCPU::ADC, IndexType::None); // ADC Absolute
+    table[0x6E] = AbsoluteReadModifyWrite(&BasicCPU::ROR, IndexType::None); // ROR Absolute
+
+    // Opcodes 0x70 to 0x7F
+    table[0x70] = Branch(&BasicCPU::OverflowSetTest); // BVS
+    table[0x71] = IndirectIndexedReadOnly(&BasicCPU::ADC); // ADC (Indirect),Y
+    table[0x75] = ZeroPageReadOnly(&BasicCPU::ADC, IndexType::X); // ADC Zero Page,X
+    table[0x76] = ZeroPageReadModifyWrite(&BasicCPU::ROR, IndexType::X); // ROR Zero Page,X
+    table[0x78] = Implied(&BasicCPU::SEI); // SEI
+    table[0x79] = AbsoluteReadOnly(&BasicCPU::ADC, IndexType::Y); // ADC Absolute,Y
+    table[0x7D] = AbsoluteReadOnly(&BasicCPU::ADC, IndexType::X); // ADC Absolute,X
+    table[0x7E] = AbsoluteReadModifyWrite(&BasicCPU::ROR, IndexType::X); // ROR Absolute,X
+
+    // Opcodes 0x80 to 0x8F
+    table[0x81] = IndexedIndirectWriteOnly(&BasicCPU::STA); // STA (Indirect,X)
+    table[0x84] = ZeroPageWriteOnly(&BasicCPU::STY, IndexType::None); // STY Zero Page
+    table[0x85] = ZeroPageWriteOnly(&BasicCPU::STA, IndexType::None); // STA Zero Page
+    table[0x86] = ZeroPageWriteOnly(&BasicCPU::STX, IndexType::None); // STX Zero Page
+    table[0x88] = Implied(&BasicCPU::DEY); // DEY
+    table[0x8A] = Implied(&BasicCPU::TXA); // TXA
+    table[0x8C] = AbsoluteWriteOnly(&BasicCPU::STY, IndexType::None); // STY Absolute
+    table[0x8D] = AbsoluteWriteOnly(&BasicCPU::STA, IndexType::None); // STA Absolute
+    table[0x8E] = AbsoluteWriteOnly(&BasicCPU::STX, IndexType::None); // STX Absolute
+
+    // Opcodes 0x90 to 0x9F
+    table[0x90] = Branch(&BasicCPU::CarryClearTest); // BCC
+    table[0x91] = IndirectIndexedWriteOnly(&BasicCPU::STA); // STA (Indirect),Y
+    table[0x94] = ZeroPageWriteOnly(&BasicCPU::STY, IndexType::X); // STY Zero Page,X
+    table[0x95] = ZeroPageWriteOnly(&BasicCPU::STA, IndexType::X); // STA Zero Page,X
+    table[0x96] = ZeroPageWriteOnly(&BasicCPU::STX, IndexType::Y); // STX Zero Page,Y
+    table[0x98] = Implied(&BasicCPU::TYA); // TYA
+    table[0x99] = AbsoluteWriteOnly(&BasicCPU::STA, IndexType::Y); // STA Absolute,Y
+    table[0x9A] = Implied(&BasicCPU::TXS); // TXS
+    table[0x9D] = AbsoluteWriteOnly(&BasicCPU::STA, IndexType::X); // STA Absolute,X
+
+    // Opcodes 0xA0 to 0xAF
+    table[0xA0] = ImmediateReadOnly(&BasicCPU::LDY); // LDY Immediate
+    table[0xA1] = IndexedIndirectReadOnly(&BasicCPU::LDA); // LDA (Indirect,X)
+    table[0xA2] = ImmediateReadOnly(&BasicCPU::LDX); // LDX Immediate
+    table[0xA4] = ZeroPageReadOnly(&BasicCPU::LDY, IndexType::None); // LDY Zero Page
+    table[0xA5] = ZeroPageReadOnly(&BasicCPU::LDA, IndexType::None); // LDA Zero Page
+    table[0xA6] = ZeroPageReadOnly(&BasicCPU::LDX, IndexType::None); // LDX Zero Page
+    table[0xA8] = Implied(&BasicCPU::TAY); // TAY
+    table[0xA9] = ImmediateReadOnly(&BasicCPU::LDA); // LDA Immediate
+    table[0xAA] = Implied(&BasicCPU::TAX); // TAX
+    table[0xAC] = AbsoluteReadOnly(&BasicCPU::LDY, IndexType::None); // LDY Absolute
+    table[0xAD] = AbsoluteReadOnly(&BasicCPU::LDA, IndexType::None); // LDA Absolute
+    table[0xAE] = AbsoluteReadOnly(&BasicCPU::LDX, IndexType::None); // LDX Absolute
+
+    // Opcodes 0xB0 to 0xBF
+    table[0xB0] = Branch(&BasicCPU::CarrySetTest); // BCS
+    table[0xB1] = IndirectIndexedReadOnly(&BasicCPU::LDA); // LDA (Indirect),Y
+    table[0xB4] = ZeroPageReadOnly(&BasicCPU::LDY, IndexType::X); // LDY Zero Page,X
+    table[0xB5] = ZeroPageReadOnly(&BasicCPU::LDA, IndexType::X); // LDA Zero Page,X
+    table[0xB6] = ZeroPageReadOnly(&BasicCPU::LDX, IndexType::Y); // LDX Zero Page,Y
+    table[0xB8] = Implied(&BasicCPU::CLV); // CLV
+    table[0xB9] = AbsoluteReadOnly(&BasicCPU::LDA, IndexType::Y); // LDA Absolute,Y
+    table[0xBA] = Implied(&BasicCPU::TSX); // TSX
+    table[0xBC] = AbsoluteReadOnly(&BasicCPU::LDY, IndexType::X); // LDY Absolute,X
+    table[0xBD] = AbsoluteReadOnly(&BasicCPU::LDA, IndexType::X); // LDA Absolute,X
+    table[0xBE] = AbsoluteReadOnly(&BasicCPU::LDX, IndexType::Y); // LDX Absolute,Y
+
+    // Opcodes 0xC0 to 0xCF
+    table[0xC0] = ImmediateReadOnly(&BasicCPU::CPY); // CPY Immediate
+    table[0xC1] = IndexedIndirectReadOnly(&BasicCPU::CMP); // CMP (Indirect,X)
+    table[0xC4] = ZeroPageReadOnly(&BasicCPU::CPY, IndexType::None); // CPY Zero Page
+    table[0xC5] = ZeroPageReadOnly(&BasicCPU::CMP, IndexType::None); // CMP Zero Page
+    table[0xC6] = ZeroPageReadModifyWrite(&BasicCPU::DEC, IndexType::None); // DEC Zero Page
+    table[0xC8] = Implied(&BasicCPU::INY); // INY
+    table[0xC9] = ImmediateReadOnly(&BasicCPU::CMP); // CMP Immediate
+    table[0xCA] = Implied(&BasicCPU::DEX); // DEX
+    table[0xCC] = AbsoluteReadOnly(&BasicCPU::CPY, IndexType::None); // CPY Absolute
+    table[0xCD] = AbsoluteReadOnly(&BasicCPU::CMP, IndexType::None); // CMP Absolute
+    table[0xCE] = AbsoluteReadModifyWrite(&BasicCPU::DEC, IndexType::None); // DEC Absolute
+
+    // Opcodes 0xD0 to 0xDF
+    table[0xD0] = Branch(&BasicCPU::NotEqualTest); // BNE
+    table[0xD1] = IndirectIndexedReadOnly(&BasicCPU::CMP); // CMP (Indirect),Y
+    table[0xD5] = ZeroPageReadOnly(&BasicCPU::CMP, IndexType::X); // CMP Zero Page,X
+    table[0xD6] = ZeroPageReadModifyWrite(&BasicCPU::DEC, IndexType::X); // DEC Zero Page,X
+    table[0xD8] = Implied(&BasicCPU::CLD); // CLD
+    table[0xD9] = AbsoluteReadOnly(&BasicCPU::CMP, IndexType::Y); // CMP Absolute,Y
+    table[0xDD] = AbsoluteReadOnly(&BasicCPU::CMP, IndexType::X); // CMP Absolute,X
+    table[0xDE] = AbsoluteReadModifyWrite(&BasicCPU::DEC, IndexType::X); // DEC Absolute,X
+
+    // Opcodes 0xE0 to 0xEF
+    table[0xE0] = ImmediateReadOnly(&BasicCPU::CPX); // CPX Immediate
+    table[0xE1] = IndexedIndirectReadOnly(&BasicCPU::SBC); // SBC (Indirect,X)
+    table[0xE4] = ZeroPageReadOnly(&BasicCPU::CPX, IndexType::None); // CPX Zero Page
+    table[0xE5] = ZeroPageReadOnly(&BasicCPU::SBC, IndexType::None); // SBC Zero Page
+    table[0xE6] = ZeroPageReadModifyWrite(&BasicCPU::INC, IndexType::None); // INC Zero Page
+    table[0xE8] = Implied(&BasicCPU::INX); // INX
+    table[0xE9] = ImmediateReadOnly(&BasicCPU::SBC); // SBC Immediate
+    table[0xEA] = NOP(); // NOP
+    table[0xEC] = AbsoluteReadOnly(&BasicCPU::CPX, IndexType::None); // CPX Absolute
+    table[0xED] = AbsoluteReadOnly(&BasicCPU::SBC, IndexType::None); // SBC Absolute
+    table[0xEE] = AbsoluteReadModifyWrite(&BasicCPU::INC, IndexType::None); // INC Absolute
+
+    // Opcodes 0xF0 to 0xFF
+    table[0xF0] = Branch(&BasicCPU::EqualTest); // BEQ
+    table[0xF1] = IndirectIndexedReadOnly(&BasicCPU::SBC); // SBC (Indirect),Y
+    table[0xF5] = ZeroPageReadOnly(&BasicCPU::SBC, IndexType::X); // SBC Zero Page,X
+    table[0xF6] = ZeroPageReadModifyWrite(&BasicCPU::INC, IndexType::X); // INC Zero Page,X
+    table[0xF8] = Implied(&BasicCPU::SED); // SED
+    table[0xF9] = AbsoluteReadOnly(&BasicCPU::SBC, IndexType::Y); // SBC Absolute,Y
+    table[0xFD] = AbsoluteReadOnly(&BasicCPU::SBC, IndexType::X); // SBC Absolute,X
+    table[0xFE] = AbsoluteReadModifyWrite(&BasicCPU::INC, IndexType::X); // INC Absolute,X
+
+    return table;
+}
+
+template <typename Bus>
+constinit const std::array<typename BasicCPU<Bus>::InstructionProgram, 256> BasicCPU<Bus>::s_instructionTable = BasicCPU<Bus>::BuildInstructionTable();
+
+// NMI and IRQ sequence, started without an opcode fetch once the current instruction completes
+template <typename Bus>
+constinit const typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::s_interruptProgram = BasicCPU<Bus>::MakeProgram({
+    MicroOp::SetInterruptInProgress,
+    MicroOp::PushPCHighByteToTheStack,
+    MicroOp::PushPCLowByteToTheStack,
+    MicroOp::PushStatusAndDecideFinalInterruptVector,
+    MicroOp::SetPCLowByteAndSetInterruptFlag,
+    MicroOp::SetPCHighByteAndClearInterruptInProgress,
+});
+
+// Empty program the CPU starts with after a reset, so the first clock fetches an opcode
+template <typename Bus>
+constinit const typename BasicCPU<Bus>::InstructionProgram BasicCPU<Bus>::s_idleProgram{};
+
+template <typename Bus>
+void BasicCPU<Bus>::FetchNextInstruction()
+{
+    uint8_t opcode = Read(reg_pc);
+    reg_pc++;
+
+    m_program = &s_instructionTable[opcode];
+    m_programStep = 0;
+
+    if (opcode == 0x00) // BRK
+    {
+        m_inProgressInterruptType = InterruptType::BRK;
+        m_mostRecentInterruptVector = IRQ_VECTOR;
+    }
+    else if (!m_program->isLegal)
+    {
+        Logger::GetInstance().Warn("unexpected opcode " + Logger::DecmialToHex(opcode));
+    }
+}
\ No newline at end of file
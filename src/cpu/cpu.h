@@ -3,12 +3,14 @@
 #include <cstdint>
 #include <memory>
 #include <stdexcept>
+#include <array>
+#include <initializer_list>
 
 #include "../debug/logger.h"
-#include "../interfaces/i-bus.h"
-#include "../common/circular-buffer.h"
 
-class CPU
+// Bus is the concrete bus type (CpuBus in the console) so memory accesses are direct calls rather than virtual ones
+template <typename Bus>
+class BasicCPU
 {
 private:
     enum class IndexType : uint8_t
@@ -44,20 +46,98 @@ public:
 
     static constexpr uint16_t STACK_BASE = 0x0100;
 
-    CPU(std::shared_ptr<IBus> bus);
-    ~CPU();
+    BasicCPU(std::shared_ptr<Bus> bus);
+    ~BasicCPU();
 
     void Reset();
     void Clock();
     void Interrupt(InterruptType type);
 
+    // Executes the next whole instruction, or a pending interrupt, and returns the number of cycles it took.
+    // Interrupts are only checked between instructions and the rest of the system is expected to catch up afterwards.
+    int Step();
+
     uint8_t GetFlag(Flag flag) const;
 
 private:
-    std::shared_ptr<IBus> m_bus;
+    using Operation = void (BasicCPU::*)();
+    using BranchTest = bool (BasicCPU::*)() const;
+
+    // Every single cycle step an instruction can be made of. Each one maps to the micro instruction method of the same name.
+    enum class MicroOp : uint8_t
+    {
+        None,
+        PerformOperation,
+        ReadProgramCounter,
+        IncrementStackPointer,
+        SetTargetAddressLowByteUsingPC,
+        SetTargetAddressHighByteUsingPC,
+        SetTargetAddressHighByteUsingXIndexedPC,
+        SetTargetAddressHighByteUsingYIndexedPC,
+        AddRegisterXToZeroPageTargetAddress,
+        AddRegisterYToZeroPageTargetAddress,
+        ReadOperandAtPCAndPerformOperation,
+        PerformOperationOnRegA,
+        PerformInvalidTargetAddressRead,
+        FetchHighByteForAbsoluteReadOnly,
+        PerformOperationOnTargetAddress,
+        ReadOperandFromTargetAddress,
+        WriteOperandToTargetAddress,
+        ReadOperandAtPCAndIncrementPC,
+        AddRegisterXToOperand,
+        SetTargetAddressLowByteUsingOperand,
+        SetTargetAddressHighByteUsingOperand,
+        FetchHighByteForIndirectIndexedReadOnly,
+        SetTargetAddressHighByteUsingYIndexedOperand,
+        CheckBranchCondition,
+        PerformBranch,
+        BlankMicroInstruction,
+        PopStatusOffTheStackAndIncrementStackPointer,
+        PopPCLowByteOffTheStackAndIncrementStackPointer,
+        PopPCHighByteOffTheStack,
+        IncrementProgramCounter,
+        PopStatusOffTheStack,
+        PushAccumulatorToTheStack,
+        PushStatusToTheStackWithBSet,
+        PopAccumulatorFromTheStackAndSetFlags,
+        ReadFromTheStackPointer,
+        PushPCHighByteToTheStack,
+        PushPCLowByteToTheStack,
+        JumpToSubroutineFinal,
+        JumpAbsoluteFinal,
+        JumpIndirectFinal,
+        PushStatusAndDecideFinalInterruptVector,
+        SetPCLowByteAndSetInterruptFlag,
+        SetPCHighByteAndClearInterruptInProgress,
+        SetInterruptInProgress,
+        SetInterruptInProgressAndIncrementPC,
+    };
 
-    // Contains "per cycle" instructions that will execute when clock is called.
-    CircularBuffer<void (CPU::*)(), 20> m_microInstructionQueue;
+    // The fixed sequence of micro instructions executed after an opcode is fetched
+    struct InstructionProgram
+    {
+        static constexpr size_t MAX_STEPS = 7;
+
+        std::array<MicroOp, MAX_STEPS> steps{};
+        uint8_t length = 0;
+        bool isLegal = false;
+        IndexType indexType = IndexType::None;
+        Operation operation = nullptr;
+        BranchTest branchTest = nullptr;
+    };
+
+    static const std::array<InstructionProgram, 256> s_instructionTable;
+    static const InstructionProgram s_interruptProgram;
+    static const InstructionProgram s_idleProgram;
+
+    std::shared_ptr<Bus> m_bus;
+
+    // The instruction currently being executed and the index of its next micro instruction
+    const InstructionProgram* m_program = &s_idleProgram;
+    uint8_t m_programStep = 0;
+
+    // Extra cycle inserted ahead of the program's next step (page crosses and taken branches)
+    MicroOp m_injectedMicroOp = MicroOp::None;
 
     uint8_t  reg_a = 0;    // Accumulator Register
     uint8_t  reg_x = 0;    // X Register
@@ -69,30 +149,26 @@ private:
     uint16_t m_targetAddress = 0;
     uint8_t m_operand = 0;
 
-    void (CPU::*m_operation)() = NULL;
-    bool (CPU::* m_branchTest)() const = NULL;
-    IndexType m_indexType = IndexType::None;
-
+    bool m_interruptQueued = false;
     bool m_interruptInProgress = false;
     InterruptType m_inProgressInterruptType;
     bool m_pendingNMI = false;
     bool m_pendingIRQ = false;
     uint16_t m_mostRecentInterruptVector = 0;
 
-    void QueueNextInstuction();
+    void FetchNextInstruction();
+    void ExecuteMicroOp(MicroOp microOp);
+    int RunProgramToCompletion();
+    void InjectMicroOp(MicroOp microOp) { m_injectedMicroOp = microOp; }
 
-    inline void Write(uint16_t address, uint8_t data)
+    int RemainingMicroOps() const
     {
-        if (m_bus != nullptr) m_bus->Write(address, data); return;
-        throw std::runtime_error("CPU tried to write to the bus before it was connected.");
+        return (m_program->length - m_programStep) + (m_injectedMicroOp != MicroOp::None ? 1 : 0);
     }
 
-    inline uint8_t Read(uint16_t address)
-    {
-        if (m_bus != nullptr) return m_bus->Read(address);
-        throw std::runtime_error("CPU tried to read from the bus before it was connected.");
-        return 0;
-    }
+    // The bus is checked once on construction so these stay free of branches
+    inline void Write(uint16_t address, uint8_t data) { m_bus->Write(address, data); }
+    inline uint8_t Read(uint16_t address) { return m_bus->Read(address); }
 
     void SetFlag(Flag flag, bool value);
 
@@ -100,30 +176,35 @@ private:
     uint8_t StackPop();
 
     void PollInterrupts();
-    void InternalInterrupt(InterruptType type);
+    void QueueInterrupt(InterruptType type);
+
+#pragma region Instruction Program Addressing Mode Builders
+    static constexpr InstructionProgram MakeProgram(std::initializer_list<MicroOp> steps, Operation operation = nullptr, IndexType indexType = IndexType::None);
 
-#pragma region Instruction Queuing Function Addressing Mode Wrappers
-    void ImmediateReadOnly();
+    static constexpr InstructionProgram ImmediateReadOnly(Operation operation);
 
-    void AccumulatorReadModifyWrite();
+    static constexpr InstructionProgram AccumulatorReadModifyWrite(Operation operation);
 
-    void AbsoluteReadOnly();
-    void AbsoluteReadModifyWrite();
-    void AbsoluteWriteOnly();
+    static constexpr InstructionProgram AbsoluteReadOnly(Operation operation, IndexType indexType);
+    static constexpr InstructionProgram AbsoluteReadModifyWrite(Operation operation, IndexType indexType);
+    static constexpr InstructionProgram AbsoluteWriteOnly(Operation operation, IndexType indexType);
 
-    void ZeroPageReadOnly();
-    void ZeroPageReadModifyWrite();
-    void ZeroPageWriteOnly();
+    static constexpr InstructionProgram ZeroPageReadOnly(Operation operation, IndexType indexType);
+    static constexpr InstructionProgram ZeroPageReadModifyWrite(Operation operation, IndexType indexType);
+    static constexpr InstructionProgram ZeroPageWriteOnly(Operation operation, IndexType indexType);
 
-    void IndexedIndirectReadOnly(); // (Indirect,X)
-    void IndexedIndirectReadModifyWrite(); // (Indirect,X)
-    void IndexedIndirectWriteOnly(); // (Indirect,X)
+    static constexpr InstructionProgram IndexedIndirectReadOnly(Operation operation); // (Indirect,X)
+    static constexpr InstructionProgram IndexedIndirectReadModifyWrite(Operation operation); // (Indirect,X)
+    static constexpr InstructionProgram IndexedIndirectWriteOnly(Operation operation); // (Indirect,X)
 
-    void IndirectIndexedReadOnly(); // (Indirect),Y
-    void IndirectIndexedReadModifyWrite(); // (Indirect),Y
-    void IndirectIndexedWriteOnly(); // (Indirect),Y
+    static constexpr InstructionProgram IndirectIndexedReadOnly(Operation operation); // (Indirect),Y
+    static constexpr InstructionProgram IndirectIndexedReadModifyWrite(Operation operation); // (Indirect),Y
+    static constexpr InstructionProgram IndirectIndexedWriteOnly(Operation operation); // (Indirect),Y
 
-    void BranchInstruction();
+    static constexpr InstructionProgram Branch(BranchTest branchTest);
+    static constexpr InstructionProgram Implied(Operation operation);
+
+    static constexpr std::array<InstructionProgram, 256> BuildInstructionTable();
 #pragma endregion
 
 #pragma region Operations Used With Multiple Addressing Modes
@@ -150,15 +231,23 @@ private:
     void CPY(); // Compare Y
 #pragma endregion
 
-#pragma region Standalone Instruction Queuing Functions
-    void RTI(); // Return from interrupt
-    void RTS(); // Return from subroutine
-    void PHA(); // Push the accumulator register to the stack
-    void PHP(); // Push the status register to the stack
-    void PLA(); // Pull the accumulator register from the stack
-    void PLP(); // Pull the status register from the stack
-    void JSR(); // Jump to subroutine
+#pragma region Standalone Instruction Programs
+    static constexpr InstructionProgram RTI(); // Return from interrupt
+    static constexpr InstructionProgram RTS(); // Return from subroutine
+    static constexpr InstructionProgram PHA(); // Push the accumulator register to the stack
+    static constexpr InstructionProgram PHP(); // Push the status register to the stack
+    static constexpr InstructionProgram PLA(); // Pull the accumulator register from the stack
+    static constexpr InstructionProgram PLP(); // Pull the status register from the stack
+    static constexpr InstructionProgram JSR(); // Jump to subroutine
+    static constexpr InstructionProgram BRK(); // Force interrupt
+    static constexpr InstructionProgram NOP(); // No operation
+
+    // ==== JMP Instructions For All Addressing Modes ====
+    static constexpr InstructionProgram JMP_Absolute(); // Absolute addressed jump
+    static constexpr InstructionProgram JMP_Indirect(); // Indirect addressed jump
+#pragma endregion
 
+#pragma region Implied Operations
     // ==== Two Cycle Instructions ====
     void TAX(); // Transfer A to X
     void TXA(); // Transfer X to A
@@ -177,10 +266,6 @@ private:
     void SED(); // Set decimal
     void CLD(); // Clear decimal
     void CLV(); // Clear overflow
-
-    // ==== JMP Instructions For All Addressing Modes ====
-    void JMP_Absolute(); // Absolute addressed jump
-    void JMP_Indirect(); // Indirect addressed jump
 #pragma endregion
 
 #pragma region Micro Instructions
@@ -238,4 +323,9 @@ private:
     bool NotEqualTest() const;
     bool EqualTest() const;
 #pragma endregion
-};
\ No newline at end of file
+};
+
+#include "cpu-common.inl"
+#include "cpu-instructions.inl"
+#include "cpu-micro-instructions.inl"
+#include "cpu-opcode-table.inl"
\ No newline at end of file
@@ -0,0 +1,48 @@
+#include "sdl-audio-output.h"
+
+SdlAudioOutput::SdlAudioOutput(int sampleRate)
+{
+    SDL_AudioSpec audioSpec;
+
+    // Configure Audio Spec
+    SDL_zero(audioSpec);
+    audioSpec.freq = sampleRate;
+    audioSpec.format = AUDIO_F32;  // 32-bit float PCM
+    audioSpec.channels = 1;        // Mono
+    audioSpec.samples = 512;       // Buffer size
+    audioSpec.callback = AudioSampleCallback;
+    audioSpec.userdata = this;
+
+    if (SDL_OpenAudio(&audioSpec, NULL) < 0)
+        throw std::runtime_error("SDL Open Audio Failed");
+
+    SDL_PauseAudio(0);
+}
+
+SdlAudioOutput::~SdlAudioOutput()
+{
+    SDL_CloseAudio();
+}
+
+void SdlAudioOutput::QueueSamples(std::vector<float>& samples)
+{
+    size_t samplesQueued = m_pendingSamples.Push(samples.data(), samples.size());
+    m_droppedSampleCount += samples.size() - samplesQueued;
+
+    samples.clear();
+}
+
+void SdlAudioOutput::AudioSampleCallback(void* userdata, Uint8* stream, int len)
+{
+    SdlAudioOutput* output = (SdlAudioOutput*)userdata;
+
+    size_t samplesRequested = len / sizeof(float);
+    size_t samplesCopied = output->m_pendingSamples.Pop(reinterpret_cast<float*>(stream), samplesRequested);
+
+    // Pad with silence when the emulator falls behind
+    if (samplesCopied < samplesRequested)
+    {
+        memset(stream + samplesCopied * sizeof(float), 0, (samplesRequested - samplesCopied) * sizeof(float));
+        output->m_underrunCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
\ No newline at end of file
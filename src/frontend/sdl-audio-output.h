@@ -0,0 +1,39 @@
+#pragma once
+
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#include <SDL2/SDL.h>
+
+#include "../common/spsc-ring-buffer.h"
+
+class SdlAudioOutput
+{
+    // Upper bound on buffered audio, samples that arrive while it is full are dropped to keep latency low
+    static constexpr size_t MAX_PENDING_SAMPLES = 4096;
+
+    // Filled by the emulation thread and drained by the SDL audio thread without either waiting on the other
+    SpscRingBuffer<float, MAX_PENDING_SAMPLES> m_pendingSamples;
+
+    std::atomic<uint64_t> m_underrunCount = 0;
+    uint64_t m_droppedSampleCount = 0;
+
+public:
+    SdlAudioOutput(int sampleRate);
+    ~SdlAudioOutput();
+
+    // Moves the given samples into the buffer drained by the SDL audio thread
+    void QueueSamples(std::vector<float>& samples);
+
+    // Number of SDL callbacks that ran out of samples and had to play silence
+    uint64_t GetUnderrunCount() const { return m_underrunCount.load(std::memory_order_relaxed); }
+
+    // Number of samples thrown away because the buffer was full
+    uint64_t GetDroppedSampleCount() const { return m_droppedSampleCount; }
+
+private:
+    static void AudioSampleCallback(void* userdata, Uint8* stream, int len);
+};
\ No newline at end of file
@@ -0,0 +1,66 @@
+#include "sdl-controller-input.h"
+
+void SdlControllerInput::HandleEvent(NES& nes, const SDL_Event& event)
+{
+    if (event.type != SDL_EventType::SDL_KEYDOWN
+        && event.type != SDL_EventType::SDL_KEYUP)
+        return;
+
+    auto key = event.key.keysym.sym;
+    bool keyPressed = event.type == SDL_EventType::SDL_KEYDOWN;
+
+    switch (key)
+    {
+    // Controller 1
+    case SDLK_l:
+        nes.SetControllerButtonState(1, NES::ControllerButton::A, keyPressed);
+        break;
+    case SDLK_k:
+        nes.SetControllerButtonState(1, NES::ControllerButton::B, keyPressed);
+        break;
+    case SDLK_g:
+        nes.SetControllerButtonState(1, NES::ControllerButton::Select, keyPressed);
+        break;
+    case SDLK_h:
+        nes.SetControllerButtonState(1, NES::ControllerButton::Start, keyPressed);
+        break;
+    case SDLK_w:
+        nes.SetControllerButtonState(1, NES::ControllerButton::Up, keyPressed);
+        break;
+    case SDLK_s:
+        nes.SetControllerButtonState(1, NES::ControllerButton::Down, keyPressed);
+        break;
+    case SDLK_a:
+        nes.SetControllerButtonState(1, NES::ControllerButton::Left, keyPressed);
+        break;
+    case SDLK_d:
+        nes.SetControllerButtonState(1, NES::ControllerButton::Right, keyPressed);
+        break;
+
+    // Controller 2
+    case SDLK_KP_3:
+        nes.SetControllerButtonState(2, NES::ControllerButton::A, keyPressed);
+        break;
+    case SDLK_KP_2:
+        nes.SetControllerButtonState(2, NES::ControllerButton::B, keyPressed);
+        break;
+    case SDLK_KP_4:
+        nes.SetControllerButtonState(2, NES::ControllerButton::Select, keyPressed);
+        break;
+    case SDLK_KP_5:
+        nes.SetControllerButtonState(2, NES::ControllerButton::Start, keyPressed);
+        break;
+    case SDLK_UP:
+        nes.SetControllerButtonState(2, NES::ControllerButton::Up, keyPressed);
+        break;
+    case SDLK_DOWN:
+        nes.SetControllerButtonState(2, NES::ControllerButton::Down, keyPressed);
+        break;
+    case SDLK_LEFT:
+        nes.SetControllerButtonState(2, NES::ControllerButton::Left, keyPressed);
+        break;
+    case SDLK_RIGHT:
+        nes.SetControllerButtonState(2, NES::ControllerButton::Right, keyPressed);
+        break;
+    }
+}
\ No newline at end of file
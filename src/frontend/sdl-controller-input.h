@@ -0,0 +1,11 @@
+#pragma once
+
+#include <SDL2/SDL.h>
+
+#include "../nes.h"
+
+struct SdlControllerInput
+{
+    // Maps keyboard events onto the controller state of the given console
+    static void HandleEvent(NES& nes, const SDL_Event& event);
+};
\ No newline at end of file
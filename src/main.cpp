@@ -5,12 +5,17 @@
 #include <iostream>
 #include <cstdlib>
 #include <algorithm>
+#include <optional>
+#include <vector>
 #include <format>
 
 #include <SDL2/SDL.h>
 
 #include "debug/logger.h"
 #include "nes.h"
+#include "frontend/sdl-audio-output.h"
+#include "frontend/sdl-controller-input.h"
+#include "common/hash.h"
 
 #ifdef _WIN32
 #define popen _popen
@@ -61,6 +66,23 @@ static void ResizeRenderer(SDL_Window* window, SDL_Renderer* renderer, int initi
     SDL_RenderSetLogicalSize(renderer, PPU::DISPLAY_WIDTH * initialScale * scale, PPU::DISPLAY_HEIGHT * initialScale * scale);
 }
 
+static void PresentFrame(SDL_Renderer* renderer, SDL_Texture* texture, const NES& nes)
+{
+    // Convert the indexed frame straight into the texture
+    void* pixels = nullptr;
+    int pitch = 0;
+    if (SDL_LockTexture(texture, nullptr, &pixels, &pitch) == 0)
+    {
+        nes.ConvertFrame(PixelFormat::RGBA8888, pixels, pitch);
+        SDL_UnlockTexture(texture);
+    }
+
+    // Clear the screen and render the texture
+    SDL_RenderClear(renderer);
+    SDL_RenderCopy(renderer, texture, nullptr, nullptr);
+    SDL_RenderPresent(renderer);
+}
+
 static void SetFullscreen(SDL_Window* window)
 {
     static bool isFullscreen = false;
@@ -72,18 +94,59 @@ static void SetFullscreen(SDL_Window* window)
         SDL_SetWindowFullscreen(window, 0);
 }
 
-int main(int argc, char* argv[])
+// Runs the emulator with no window, audio device or frame pacing and reports its throughput
+static int RunBenchmark(const std::string& romPath, const std::string& palettePath, int frameCount, NES::CpuExecutionMode cpuMode, bool indexedOutput)
 {
-    SDL_Init(SDL_INIT_EVERYTHING);
+    try
+    {
+        NES nes(romPath);
+        nes.SetCpuExecutionMode(cpuMode);
+        nes.SetIndexedFrameOutput(indexedOutput);
+        if (!palettePath.empty()) nes.LoadColourPalette(palettePath);
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < frameCount; i++)
+        {
+            nes.RunFrame();
+            nes.GetAudioSamples().clear();
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        // The hash is always of the RGBA frame, so indexed runs convert their last frame for it
+        std::vector<uint32_t> frame(nes.GetFrameBuffer(), nes.GetFrameBuffer() + PPU::DISPLAY_WIDTH * PPU::DISPLAY_HEIGHT);
+        if (indexedOutput) nes.ConvertFrame(PixelFormat::RGBA8888, frame.data(), PPU::DISPLAY_WIDTH * sizeof(uint32_t));
 
+        double seconds = std::chrono::duration<double>(end - start).count();
+        double cpuCyclesPerSecond = nes.GetCpuCycleCount() / seconds;
+        double ppuDotsPerSecond = nes.GetPpuDotCount() / seconds;
+        uint64_t frameHash = Hash::Fnv1a64(frame.data(), PPU::DISPLAY_WIDTH * PPU::DISPLAY_HEIGHT * sizeof(uint32_t));
+
+        std::cout << std::format("Frames:          {}\n", frameCount);
+        std::cout << std::format("Elapsed:         {:.3f} s\n", seconds);
+        std::cout << std::format("Frames/sec:      {:.1f}\n", frameCount / seconds);
+        std::cout << std::format("CPU cycles/sec:  {:.3f} MHz ({:.2f}x real time)\n",
+            cpuCyclesPerSecond / 1e6, cpuCyclesPerSecond / AudioConstants::CLOCK_RATE);
+        std::cout << std::format("PPU dots/sec:    {:.3f} MHz\n", ppuDotsPerSecond / 1e6);
+        std::cout << std::format("Frame hash:      0x{:016X}\n", frameHash);
+    }
+    catch (const std::runtime_error& e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
     Logger::GetInstance().SetLoggingMode(Logger::LoggingMode::Disabled);
     std::string romPath;
-
-    // Determine max window scale
-    SDL_Rect displayBounds;
-    SDL_GetDisplayBounds(0, &displayBounds);
-    int maxScale = std::min<int>(displayBounds.w / PPU::DISPLAY_WIDTH, displayBounds.h / PPU::DISPLAY_HEIGHT);
-    int windowScale = maxScale;
+    std::string palettePath;
+    std::optional<int> requestedScale;
+    int benchmarkFrames = 0;
+    NES::CpuExecutionMode cpuMode = NES::CpuExecutionMode::CycleAccurate;
+    bool indexedBenchmark = false;
 
     // Handle all program arguments
     for (int i = 1; i < argc; i++)
@@ -97,11 +160,40 @@ int main(int argc, char* argv[])
             romPath = argv[i];
             continue;
         }
+        else if (arg == "--palette" || arg == "-p")
+        {
+            if (i + 1 >= argc) continue;
+            i++;
+            palettePath = argv[i];
+            continue;
+        }
         else if (arg == "--scale" || arg == "-s")
         {
             if (i + 1 >= argc) continue;
             i++;
-            windowScale = std::atoi(argv[i]);
+            requestedScale = std::atoi(argv[i]);
+            continue;
+        }
+        else if (arg == "--benchmark")
+        {
+            if (i + 1 >= argc) continue;
+            i++;
+            benchmarkFrames = std::atoi(argv[i]);
+            if (benchmarkFrames <= 0)
+            {
+                std::cerr << "Error: --benchmark requires a positive frame count." << std::endl;
+                return -1;
+            }
+            continue;
+        }
+        else if (arg == "--fast-cpu")
+        {
+            cpuMode = NES::CpuExecutionMode::InstructionStep;
+            continue;
+        }
+        else if (arg == "--indexed")
+        {
+            indexedBenchmark = true;
             continue;
         }
         else if (arg == "--console-logging")
@@ -111,6 +203,24 @@ int main(int argc, char* argv[])
         }
     }
 
+    if (benchmarkFrames > 0)
+    {
+        if (romPath.empty())
+        {
+            std::cerr << "Error: --benchmark requires a ROM passed with --filename." << std::endl;
+            return -1;
+        }
+        return RunBenchmark(romPath, palettePath, benchmarkFrames, cpuMode, indexedBenchmark);
+    }
+
+    SDL_Init(SDL_INIT_EVERYTHING);
+
+    // Determine max window scale
+    SDL_Rect displayBounds;
+    SDL_GetDisplayBounds(0, &displayBounds);
+    int maxScale = std::min<int>(displayBounds.w / PPU::DISPLAY_WIDTH, displayBounds.h / PPU::DISPLAY_HEIGHT);
+    int windowScale = requestedScale.value_or(maxScale);
+
     if (romPath.empty()) romPath = OpenFileDialog();
 
     // Check if a filename was provided
@@ -156,6 +266,10 @@ int main(int argc, char* argv[])
     try
     {
         auto nes = std::make_unique<NES>(romPath);
+        nes->SetCpuExecutionMode(cpuMode);
+        nes->SetIndexedFrameOutput(true);
+        if (!palettePath.empty()) nes->LoadColourPalette(palettePath);
+        SdlAudioOutput audioOutput(NES::OUTPUT_AUDIO_SAMPLE_RATE);
         bool running = true;
 
         constexpr std::chrono::nanoseconds interval(16639267);  // Target loop interval (~60 fps)
@@ -169,15 +283,20 @@ int main(int argc, char* argv[])
                 if (event.type == SDL_WINDOWEVENT && event.window.event == SDL_WINDOWEVENT_RESIZED) 
                     ResizeRenderer(window, renderer, windowScale);
                 if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F11) SetFullscreen(window);
-                else nes->CheckControllerInput(event);
+                else SdlControllerInput::HandleEvent(*nes, event);
             }
 
-            nes->DrawFrame(renderer, texture);
+            nes->RunFrame();
+            PresentFrame(renderer, texture, *nes);
+            audioOutput.QueueSamples(nes->GetAudioSamples());
 
             // Wait for the next frame to keep a consistent framerate
             std::this_thread::sleep_until(next_wakeup);
             next_wakeup += interval;
         }
+
+        Logger::GetInstance().Log(std::format("Audio underruns: {}, samples dropped: {}",
+            audioOutput.GetUnderrunCount(), audioOutput.GetDroppedSampleCount()));
     }
     catch (const std::runtime_error& e)
     {
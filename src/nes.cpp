@@ -1,144 +1,214 @@
 #include "nes.h"
 
-NES::NES(const std::string& romPath) : m_romPath(romPath)
+NES::NES(const std::string& romPath)
 {
-    m_controllerOneState = std::make_shared<uint8_t>(0);
-    m_controllerTwoState = std::make_shared<uint8_t>(0);
+    m_cartridge = std::make_shared<Cartridge>();
+    m_cartridge->LoadROM(romPath);
 
-    InitializeCartridge();
-    InitializePPU();
-    InitializeAPU();
-    InitializeCPU();
+    InitializeConsole();
+}
+
+NES::NES(const std::vector<uint8_t>& romData)
+{
+    m_cartridge = std::make_shared<Cartridge>();
+    m_cartridge->LoadROM(romData);
+
+    InitializeConsole();
 }
 
 NES::~NES()
 {
-    SDL_CloseAudio();
 }
 
-void NES::DrawFrame(SDL_Renderer* renderer, SDL_Texture* texture)
+const uint32_t* NES::RunFrame()
 {
+    // The frame can only complete on a PPU timing event
     while (!m_ppu->FrameIsComplete())
+        RunToNextEvent(Scheduler::NEVER);
+
+    m_ppu->ClearFrameComplete();
+    ResampleAudio();
+
+    return m_ppu->GetPixelBuffer();
+}
+
+int NES::RunCycles(uint64_t cycles)
+{
+    int framesCompleted = 0;
+    uint64_t targetCycle = m_scheduler->GetMasterCycle() + cycles * Scheduler::MASTER_CYCLES_PER_CPU_CYCLE;
+    while (m_scheduler->GetMasterCycle() < targetCycle)
     {
-        bool nmiInterruptRaised = false;
-        for (int i = 0; i < 3; i++)
+        RunToNextEvent(targetCycle);
+
+        if (m_ppu->FrameIsComplete())
         {
-            m_ppu->Clock();
-            nmiInterruptRaised |= m_ppu->NmiInterruptWasRaised();
+            m_ppu->ClearFrameComplete();
+            framesCompleted++;
         }
+    }
+
+    // Leave the frame buffer matching the cycles that were run
+    CatchUpPPU();
+    if (m_ppu->FrameIsComplete())
+    {
+        m_ppu->ClearFrameComplete();
+        framesCompleted++;
+    }
+
+    ResampleAudio();
+    return framesCompleted;
+}
 
-        if (nmiInterruptRaised)
-            m_cpu->Interrupt(CPU::InterruptType::NMI);
+void NES::RunToNextEvent(uint64_t limit)
+{
+    if (m_cpuExecutionMode == CpuExecutionMode::CycleAccurate)
+    {
+        // The CPU can schedule events (e.g. by writing $4014), so the next event is re-read every cycle
+        while (m_scheduler->GetMasterCycle() < std::min(m_scheduler->GetNextEventCycle(), limit))
+            ClockCpuCycle();
 
-        if (m_cartridge->PollIrqInterrupt())
-            m_cpu->Interrupt(CPU::InterruptType::IRQ);
+        if (m_scheduler->GetNextEventCycle() <= m_scheduler->GetMasterCycle() && m_scheduler->GetMasterCycle() < limit)
+            ClockEventCycle();
+    }
+    else
+    {
+        while (m_scheduler->GetMasterCycle() < std::min(m_scheduler->GetNextEventCycle(), limit))
+            StepCpuInstruction();
 
-        m_oddCpuCycle = !m_oddCpuCycle;
-        if (!m_cpuBus->TryDirectMemoryAccess(m_oddCpuCycle))
-            m_cpu->Clock();
+        HandleEventsAfterStep();
     }
+}
+
+void NES::ClockCpuCycle()
+{
+    // The PPU is left behind here and catches up when the CPU touches it or at the next event
+    m_cpu->Clock();
+    m_scheduler->AdvanceCpuCycles(1);
+}
+
+void NES::ClockEventCycle()
+{
+    if (m_scheduler->IsDue(Scheduler::Event::OamDma) && TryBulkDirectMemoryAccess()) return;
+
+    bool ppuTimingDue = m_scheduler->IsDue(Scheduler::Event::PpuTiming);
+
+    // Run the PPU through the end of this cycle so any NMI it raises is seen now
+    m_ppu->RunUntil(m_scheduler->GetPpuDot() + 3);
 
-    uint32_t* pixelBuffer = m_ppu->GetPixelBuffer();
+    if (m_ppu->NmiInterruptWasRaised())
+        m_cpu->Interrupt(CPU::InterruptType::NMI);
 
-    // Update the texture with the current frame
-    SDL_UpdateTexture(texture, nullptr, pixelBuffer, PPU::DISPLAY_WIDTH * sizeof(uint32_t));
+    if (m_cartridge->PollIrqInterrupt())
+        m_cpu->Interrupt(CPU::InterruptType::IRQ);
 
-    // Clear the screen and render the texture
-    SDL_RenderClear(renderer);
-    SDL_RenderCopy(renderer, texture, nullptr, nullptr);
-    SDL_RenderPresent(renderer);
+    if (!m_cpuBus->TryDirectMemoryAccess(CpuCycleIsOdd()))
+        m_cpu->Clock();
+
+    m_scheduler->AdvanceCpuCycles(1);
+
+    if (ppuTimingDue) SchedulePpuTiming();
+    if (m_scheduler->IsDue(Scheduler::Event::OamDma) && !m_cpuBus->DirectMemoryAccessPending())
+        m_scheduler->Cancel(Scheduler::Event::OamDma);
 }
 
-void NES::CheckControllerInput(const SDL_Event& event)
+void NES::StepCpuInstruction()
 {
-    if (event.type != SDL_EventType::SDL_KEYDOWN
-        && event.type != SDL_EventType::SDL_KEYUP)
-        return;
+    int cycles = m_cpu->Step();
+    m_scheduler->AdvanceCpuCycles(cycles);
+}
 
-    auto key = event.key.keysym.sym;
-    bool keyPressed = event.type == SDL_EventType::SDL_KEYDOWN;
+void NES::HandleEventsAfterStep()
+{
+    // Instructions run whole, so events are handled as soon as the instruction they fell in completes
+    CatchUpPPU();
 
-    switch (key)
+    while (m_scheduler->GetNextEventCycle() <= m_scheduler->GetMasterCycle())
     {
-    // Controller 1
-    case SDLK_l:
-        SetControllerButtonState(1, ControllerButton::A, keyPressed);
-        break;
-    case SDLK_k:
-        SetControllerButtonState(1, ControllerButton::B, keyPressed);
-        break;
-    case SDLK_g:
-        SetControllerButtonState(1, ControllerButton::Select, keyPressed);
-        break;
-    case SDLK_h:
-        SetControllerButtonState(1, ControllerButton::Start, keyPressed);
-        break;
-    case SDLK_w:
-        SetControllerButtonState(1, ControllerButton::Up, keyPressed);
-        break;
-    case SDLK_s:
-        SetControllerButtonState(1, ControllerButton::Down, keyPressed);
-        break;
-    case SDLK_a:
-        SetControllerButtonState(1, ControllerButton::Left, keyPressed);
-        break;
-    case SDLK_d:
-        SetControllerButtonState(1, ControllerButton::Right, keyPressed);
-        break;
-
-    // Controller 2
-    case SDLK_KP_3:
-        SetControllerButtonState(2, ControllerButton::A, keyPressed);
-        break;
-    case SDLK_KP_2:
-        SetControllerButtonState(2, ControllerButton::B, keyPressed);
-        break;
-    case SDLK_KP_4:
-        SetControllerButtonState(2, ControllerButton::Select, keyPressed);
-        break;
-    case SDLK_KP_5:
-        SetControllerButtonState(2, ControllerButton::Start, keyPressed);
-        break;
-    case SDLK_UP:
-        SetControllerButtonState(2, ControllerButton::Up, keyPressed);
-        break;
-    case SDLK_DOWN:
-        SetControllerButtonState(2, ControllerButton::Down, keyPressed);
-        break;
-    case SDLK_LEFT:
-        SetControllerButtonState(2, ControllerButton::Left, keyPressed);
-        break;
-    case SDLK_RIGHT:
-        SetControllerButtonState(2, ControllerButton::Right, keyPressed);
-        break;
+        if (m_scheduler->IsDue(Scheduler::Event::PpuTiming))
+        {
+            if (m_ppu->NmiInterruptWasRaised())
+                m_cpu->Interrupt(CPU::InterruptType::NMI);
+
+            SchedulePpuTiming();
+        }
+
+        if (m_scheduler->IsDue(Scheduler::Event::OamDma))
+        {
+            m_scheduler->Cancel(Scheduler::Event::OamDma);
+            RunDirectMemoryAccess();
+        }
     }
+
+    if (m_cartridge->PollIrqInterrupt())
+        m_cpu->Interrupt(CPU::InterruptType::IRQ);
 }
 
-void NES::AudioSampleCallback(void* userdata, Uint8* stream, int len)
+void NES::RunDirectMemoryAccess()
 {
-    static std::vector<float> audioBuffer;
+    // The whole transfer runs before the next instruction
+    if (TryBulkDirectMemoryAccess()) return;
 
-    APU* apu = (APU*)userdata;
-    std::vector<float>& apuSampleBuffer = apu->GetBuffer();
+    while (m_cpuBus->TryDirectMemoryAccess(CpuCycleIsOdd()))
+        m_scheduler->AdvanceCpuCycles(1);
 
-    int samplesToCopy = len / sizeof(float);
+    CatchUpPPU();
+}
 
-    // Allow SDL_Audio to dictate when the APU is clocked
-    while (apuSampleBuffer.size() < samplesToCopy * AudioConstants::CLOCK_RATE / OUTPUT_AUDIO_SAMPLE_RATE)
-        apu->Clock();
+bool NES::TryBulkDirectMemoryAccess()
+{
+    int cycles = m_cpuBus->TryBulkDirectMemoryAccess(CpuCycleIsOdd());
+    if (cycles == 0) return false;
 
-    AudioUtils::LowPassFilter(apuSampleBuffer, 5000.0, AudioConstants::CLOCK_RATE);
-    AudioUtils::ResampleAndAppend(apuSampleBuffer, audioBuffer, AudioConstants::CLOCK_RATE, OUTPUT_AUDIO_SAMPLE_RATE);
-    apuSampleBuffer.clear();
+    m_scheduler->AdvanceCpuCycles(cycles);
+    m_scheduler->Cancel(Scheduler::Event::OamDma);
 
-    memcpy(stream, audioBuffer.data(), samplesToCopy * sizeof(float));
-    audioBuffer.clear();
+    // The stall can run past a PPU timing point, so catch up and pick up any NMI before the CPU resumes
+    SchedulePpuTiming();
+    if (m_ppu->NmiInterruptWasRaised())
+        m_cpu->Interrupt(CPU::InterruptType::NMI);
+
+    return true;
 }
 
-void NES::InitializeCartridge()
+void NES::CatchUpPPU()
 {
-    m_cartridge = std::make_shared<Cartridge>();
-    m_cartridge->LoadROM(m_romPath);
+    m_ppu->RunUntil(m_scheduler->GetPpuDot());
+}
+
+void NES::SchedulePpuTiming()
+{
+    // The PPU is clocked three times per CPU cycle, so the event goes on the CPU cycle that runs the timing dot
+    CatchUpPPU();
+    uint64_t timingDot = m_scheduler->GetCpuCycle() * 3 + m_ppu->GetDotsUntilTimingPoint();
+    uint64_t timingCycle = timingDot / 3;
+
+    // Stepped instructions only hand back control between instructions, so wait for that cycle to be complete
+    if (m_cpuExecutionMode == CpuExecutionMode::InstructionStep) timingCycle++;
+
+    m_scheduler->Schedule(Scheduler::Event::PpuTiming, timingCycle * Scheduler::MASTER_CYCLES_PER_CPU_CYCLE);
+}
+
+void NES::ResampleAudio()
+{
+    m_apu->RunUntil(m_scheduler->GetCpuCycle());
+
+    // The APU's samples are already at the output rate, so only the new ones need filtering
+    size_t firstNewSample = m_audioSamples.size();
+    m_apu->ReadSamples(m_audioSamples);
+    m_audioFilterChain.Process(std::span<float>(m_audioSamples).subspan(firstNewSample));
+}
+
+void NES::InitializeConsole()
+{
+    m_controllerOneState = std::make_shared<uint8_t>(0);
+    m_controllerTwoState = std::make_shared<uint8_t>(0);
+    m_scheduler = std::make_shared<Scheduler>();
+
+    InitializePPU();
+    InitializeAPU();
+    InitializeCPU();
+
+    SchedulePpuTiming();
 }
 
 void NES::InitializePPU()
@@ -150,23 +220,7 @@ void NES::InitializePPU()
 
 void NES::InitializeAPU()
 {
-    m_apu = std::make_shared<APU>();
-
-    SDL_AudioSpec audioSpec;
-
-    // Configure Audio Spec
-    SDL_zero(audioSpec);
-    audioSpec.freq = OUTPUT_AUDIO_SAMPLE_RATE;
-    audioSpec.format = AUDIO_F32;  // 32-bit float PCM
-    audioSpec.channels = 1;        // Mono
-    audioSpec.samples = 512;       // Buffer size
-    audioSpec.callback = AudioSampleCallback;
-    audioSpec.userdata = m_apu.get();
-
-    if (SDL_OpenAudio(&audioSpec, NULL) < 0)
-        throw std::runtime_error("SDL Open Audio Failed");
-
-    SDL_PauseAudio(0);
+    m_apu = std::make_shared<APU>(OUTPUT_AUDIO_SAMPLE_RATE);
 }
 
 void NES::InitializeCPU()
@@ -176,9 +230,21 @@ void NES::InitializeCPU()
     m_cpuBus->ConnectCartridge(m_cartridge);
     m_cpuBus->ConnectPPU(m_ppu);
     m_cpuBus->ConnectAPU(m_apu);
+    m_cpuBus->ConnectScheduler(m_scheduler);
     m_cpu = std::make_unique<CPU>(m_cpuBus);
 }
 
+void NES::SetCpuExecutionMode(CpuExecutionMode mode)
+{
+    m_cpuExecutionMode = mode;
+    SchedulePpuTiming();
+}
+
+void NES::LoadColourPalette(const std::string& palettePath)
+{
+    m_ppu->SetColourPalettes(ColourPalette::LoadFromFile(palettePath));
+}
+
 void NES::SetControllerButtonState(uint8_t controllerNumber, ControllerButton button, bool newState) const
 {
     std::shared_ptr<uint8_t> controller;
@@ -2,21 +2,22 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 #include <cstdint>
 #include <stdexcept>
 
-#include <SDL2/SDL.h>
-
 #include "debug/logger.h"
 #include "cpu/cpu.h"
 #include "cpu/cpu-bus.h"
 #include "cartridge/cartridge.h"
 #include "audio/apu.h"
-#include "audio/audio-utils.h"
+#include "audio/audio-filter-chain.h"
 #include "audio/audio-constants.h"
+#include "scheduler.h"
 
 class NES
 {
+public:
     enum class ControllerButton : uint8_t
     {
         Right = 0x01,
@@ -29,36 +30,78 @@ class NES
         A = 0x80
     };
 
-public:
+    enum class CpuExecutionMode : uint8_t
+    {
+        CycleAccurate,      // The CPU, PPU and APU are interleaved every CPU cycle
+        InstructionStep     // Whole CPU instructions run at once and the PPU and APU catch up afterwards
+    };
+
+    static constexpr int OUTPUT_AUDIO_SAMPLE_RATE = 44100;
+
     NES(const std::string& romPath);
+    NES(const std::vector<uint8_t>& romData);
     ~NES();
 
-    void DrawFrame(SDL_Renderer* renderer, SDL_Texture* texture);
-    void CheckControllerInput(const SDL_Event& event);
+    // Runs the console until the PPU completes a frame and returns the finished frame
+    const uint32_t* RunFrame();
 
-private:
-    static constexpr int OUTPUT_AUDIO_SAMPLE_RATE = 44100;
+    // Runs the console for the given number of CPU cycles and returns the number of frames completed
+    int RunCycles(uint64_t cycles);
 
-    std::string m_romPath;
+    const uint32_t* GetFrameBuffer() const { return m_ppu->GetPixelBuffer(); }
 
+    // With indexed output the PPU only writes colour indices, which is all headless users need. Frames are then read
+    // with GetIndexedFrame or converted with ConvertFrame, and GetFrameBuffer (and RunFrame's result) is not updated.
+    void SetIndexedFrameOutput(bool enabled) { m_ppu->SetIndexedOutput(enabled); }
+    const uint8_t* GetIndexedFrame() const { return m_ppu->GetIndexBuffer(); }
+    void ConvertFrame(PixelFormat format, void* pixels, size_t pitch) const { m_ppu->ConvertFrame(format, pixels, pitch); }
+
+    uint64_t GetCpuCycleCount() const { return m_scheduler->GetCpuCycle(); }
+    uint64_t GetPpuDotCount() const { return m_scheduler->GetPpuDot(); }
+
+    // Audio produced since the last call, resampled to OUTPUT_AUDIO_SAMPLE_RATE. The caller is expected to drain it.
+    std::vector<float>& GetAudioSamples() { return m_audioSamples; }
+
+    // Draws with the colours from a .pal file instead of the built in palette
+    void LoadColourPalette(const std::string& palettePath);
+
+    void SetControllerButtonState(uint8_t controllerNumber, ControllerButton button, bool newState) const;
+
+    // Instruction stepping is faster but games that rely on mid-instruction timing may not run correctly
+    void SetCpuExecutionMode(CpuExecutionMode mode);
+    CpuExecutionMode GetCpuExecutionMode() const { return m_cpuExecutionMode; }
+
+private:
     std::shared_ptr<Cartridge> m_cartridge;
     std::shared_ptr<PPU> m_ppu;
     std::shared_ptr<PpuBus> m_ppuBus;
     std::shared_ptr<APU> m_apu;
     std::unique_ptr<CPU> m_cpu;
     std::shared_ptr<CpuBus> m_cpuBus;
+    std::shared_ptr<Scheduler> m_scheduler;
 
     std::shared_ptr<uint8_t> m_controllerOneState;
     std::shared_ptr<uint8_t> m_controllerTwoState;
 
-    bool m_oddCpuCycle = false;
+    std::vector<float> m_audioSamples;
+    AudioFilterChain m_audioFilterChain{ OUTPUT_AUDIO_SAMPLE_RATE };
 
-    static void AudioSampleCallback(void* userdata, Uint8* stream, int len);
+    CpuExecutionMode m_cpuExecutionMode = CpuExecutionMode::CycleAccurate;
 
-    void InitializeCartridge();
+    void InitializeConsole();
     void InitializePPU();
     void InitializeAPU();
     void InitializeCPU();
 
-    void SetControllerButtonState(uint8_t controllerNumber, ControllerButton button, bool newState) const;
+    void RunToNextEvent(uint64_t limit);
+    void ClockCpuCycle();
+    void ClockEventCycle();
+    void StepCpuInstruction();
+    void HandleEventsAfterStep();
+    void RunDirectMemoryAccess();
+    bool TryBulkDirectMemoryAccess();
+    void CatchUpPPU();
+    void SchedulePpuTiming();
+    bool CpuCycleIsOdd() const { return (m_scheduler->GetCpuCycle() & 1) == 0; } // Cycles are counted from one here
+    void ResampleAudio();
 };
\ No newline at end of file
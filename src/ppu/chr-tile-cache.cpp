@@ -0,0 +1,32 @@
+#include "chr-tile-cache.h"
+#include "pixel-kernels.h"
+
+void ChrTileCache::Attach(const uint8_t* chrMemory, size_t size)
+{
+    size_t tileCount = (size + TILE_SIZE - 1) / TILE_SIZE;
+
+    m_chrMemory = chrMemory;
+    m_rows.assign(tileCount * 2 * TILE_HEIGHT, TileRow{});
+    m_tileIsDecoded.assign(tileCount, false);
+}
+
+ChrTileCache::TileRow ChrTileCache::DecodeRow(uint8_t lowPlane, uint8_t highPlane, bool flipHorizontally)
+{
+    TileRow row;
+    PixelKernels::DecodeTileRow(lowPlane, highPlane, flipHorizontally, row.data());
+    return row;
+}
+
+void ChrTileCache::DecodeTile(size_t tile)
+{
+    const uint8_t* tileData = m_chrMemory + tile * TILE_SIZE;
+    TileRow* rows = &m_rows[tile * 2 * TILE_HEIGHT];
+
+    for (size_t y = 0; y < TILE_HEIGHT; y++)
+    {
+        rows[y] = DecodeRow(tileData[y], tileData[y + 8]);
+        rows[TILE_HEIGHT + y] = DecodeRow(tileData[y], tileData[y + 8], true);
+    }
+
+    m_tileIsDecoded[tile] = true;
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+// Pattern table tiles decoded into 2-bit pixel indices, with a horizontally flipped copy for sprites.
+// Tiles are keyed by their offset into CHR memory rather than by bank, so bank switches never invalidate anything.
+class ChrTileCache
+{
+public:
+    static constexpr size_t TILE_SIZE = 16;     // Two 8 byte bit planes
+    static constexpr size_t TILE_HEIGHT = 8;
+
+    using TileRow = std::array<uint8_t, 8>;     // Pixel indices from left to right
+
+    void Attach(const uint8_t* chrMemory, size_t size);
+
+    // Takes a pointer to a row of a tile's low bit plane and returns that row decoded
+    const TileRow& GetRow(const uint8_t* rowData, bool flipHorizontally)
+    {
+        size_t offset = rowData - m_chrMemory;
+        size_t tile = offset / TILE_SIZE;
+        if (!m_tileIsDecoded[tile]) DecodeTile(tile);
+
+        return m_rows[(tile * 2 + flipHorizontally) * TILE_HEIGHT + (offset & (TILE_HEIGHT - 1))];
+    }
+
+    // Must be called after every write to CHR memory
+    void Invalidate(const uint8_t* data) { m_tileIsDecoded[(data - m_chrMemory) / TILE_SIZE] = false; }
+
+    static TileRow DecodeRow(uint8_t lowPlane, uint8_t highPlane, bool flipHorizontally = false);
+
+private:
+    const uint8_t* m_chrMemory = nullptr;
+
+    // Per tile, its eight rows followed by the same rows flipped. Tiles are decoded the first time they are used.
+    std::vector<TileRow> m_rows;
+    std::vector<uint8_t> m_tileIsDecoded;
+
+    void DecodeTile(size_t tile);
+};
\ No newline at end of file
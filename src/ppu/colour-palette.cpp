@@ -0,0 +1,30 @@
+#include "colour-palette.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <vector>
+#include <stdexcept>
+
+EmphasisPalettes ColourPalette::LoadFromFile(const std::string& filename)
+{
+    std::ifstream file(filename, std::ifstream::binary);
+    if (!file.is_open()) throw std::runtime_error("Failed to open file: " + filename);
+
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    constexpr size_t BYTES_PER_TABLE = 64 * 3;
+    if (data.size() != BYTES_PER_TABLE && data.size() != BYTES_PER_TABLE * 8)
+        throw std::runtime_error("Palette files must hold 64 or 512 RGB colours: " + filename);
+
+    std::array<uint32_t, 64 * 8> colours{};
+    for (size_t i = 0; i < data.size() / 3; i++)
+        colours[i] = (static_cast<uint32_t>(data[i * 3]) << 24) | (data[i * 3 + 1] << 16) | (data[i * 3 + 2] << 8) | 0xFF;
+
+    if (data.size() == BYTES_PER_TABLE) return ApplyEmphasis(colours.data());
+
+    EmphasisPalettes palettes{};
+    for (size_t emphasis = 0; emphasis < palettes.size(); emphasis++)
+        std::copy_n(&colours[emphasis * 64], 64, palettes[emphasis].begin());
+    return palettes;
+}
\ No newline at end of file
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <cstdint>
+#include <array>
+#include <string>
 
-const uint32_t COLOUR_PALETTE[]
+constexpr uint32_t COLOUR_PALETTE[64]
 {
     // 0x00 - 0x0F
     0x626262FF,
@@ -75,4 +77,66 @@ const uint32_t COLOUR_PALETTE[]
     0xB8B8B8FF,
     0x000000FF,
     0x000000FF
-};
\ No newline at end of file
+};
+
+// Layouts frames can be converted to. The 32 bit formats are packed with the first channel in the top byte.
+enum class PixelFormat : uint8_t
+{
+    RGBA8888,
+    ARGB8888,
+    RGB565
+};
+
+// One 64 colour table for each combination of PPUMASK's emphasis bits (red, green and blue from bit 0)
+using EmphasisPalettes = std::array<std::array<uint32_t, 64>, 8>;
+
+struct ColourPalette
+{
+    // Builds the emphasis tables from 64 RGBA colours. Each emphasised channel darkens the other two by the
+    // attenuation measured on NTSC consoles.
+    static constexpr EmphasisPalettes ApplyEmphasis(const uint32_t* colours)
+    {
+        constexpr double ATTENUATION = 0.816328;
+
+        EmphasisPalettes palettes{};
+        for (int emphasis = 0; emphasis < 8; emphasis++)
+        {
+            for (int colour = 0; colour < 64; colour++)
+            {
+                uint32_t result = colours[colour] & 0xFF;
+                for (int channel = 0; channel < 3; channel++)
+                {
+                    int shift = 24 - channel * 8;
+                    double value = (colours[colour] >> shift) & 0xFF;
+                    for (int bit = 0; bit < 3; bit++)
+                    {
+                        if ((emphasis & (1 << bit)) && bit != channel) value *= ATTENUATION;
+                    }
+                    result |= static_cast<uint32_t>(value + 0.5) << shift;
+                }
+                palettes[emphasis][colour] = result;
+            }
+        }
+        return palettes;
+    }
+
+    // Converts an RGBA8888 colour to the given format (RGB565 in the low 16 bits)
+    static constexpr uint32_t ConvertColour(uint32_t rgba, PixelFormat format)
+    {
+        switch (format)
+        {
+        case PixelFormat::ARGB8888:
+            return (rgba >> 8) | (rgba << 24);
+        case PixelFormat::RGB565:
+            return ((rgba >> 16) & 0xF800) | ((rgba >> 13) & 0x07E0) | ((rgba >> 11) & 0x001F);
+        default:
+            return rgba;
+        }
+    }
+
+    // Reads a .pal file of RGB triples: either 64 colours, which get the same emphasis treatment as the
+    // built in palette, or 512 with a table for every emphasis combination
+    static EmphasisPalettes LoadFromFile(const std::string& filename);
+};
+
+constexpr EmphasisPalettes DEFAULT_EMPHASIS_PALETTES = ColourPalette::ApplyEmphasis(COLOUR_PALETTE);
\ No newline at end of file
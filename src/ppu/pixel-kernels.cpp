@@ -0,0 +1,172 @@
+#include "pixel-kernels.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PIXEL_KERNELS_SSE2
+#endif
+
+namespace
+{
+    uint8_t MergePixel(uint8_t background, uint8_t sprite, bool& spriteZeroHit)
+    {
+        bool backgroundIsOpaque = (background & 0x03) != 0;
+        bool spriteIsOpaque = (sprite & 0x03) != 0;
+
+        if (backgroundIsOpaque && spriteIsOpaque && (sprite & PixelKernels::SPRITE_ZERO)) spriteZeroHit = true;
+
+        if (spriteIsOpaque && !(backgroundIsOpaque && (sprite & PixelKernels::SPRITE_BEHIND_BACKGROUND)))
+            return 0x10 | (sprite & 0x0F);
+
+        return backgroundIsOpaque ? background & 0x0F : 0;
+    }
+}
+
+void PixelKernels::DecodeTileRow(uint8_t lowPlane, uint8_t highPlane, bool flipHorizontally, uint8_t* pixels)
+{
+#if defined(PIXEL_KERNELS_SSE2)
+    // Give each lane one bit of the planes to test, then keep bit 0 of the low result and bit 1 of the high result
+    const __m128i bits = flipHorizontally
+        ? _mm_setr_epi8(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, char(0x80), 0, 0, 0, 0, 0, 0, 0, 0)
+        : _mm_setr_epi8(char(0x80), 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0, 0, 0, 0, 0, 0, 0, 0);
+
+    __m128i low = _mm_cmpeq_epi8(_mm_and_si128(_mm_set1_epi8(static_cast<char>(lowPlane)), bits), bits);
+    __m128i high = _mm_cmpeq_epi8(_mm_and_si128(_mm_set1_epi8(static_cast<char>(highPlane)), bits), bits);
+    __m128i result = _mm_or_si128(_mm_and_si128(low, _mm_set1_epi8(1)), _mm_and_si128(high, _mm_set1_epi8(2)));
+
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(pixels), result);
+#else
+    for (int i = 0; i < 8; i++)
+    {
+        int bit = flipHorizontally ? i : 7 - i;
+        pixels[i] = (((highPlane >> bit) & 1) << 1) | ((lowPlane >> bit) & 1);
+    }
+#endif
+}
+
+bool PixelKernels::MergeScanline(const uint8_t* background, const uint8_t* sprites, uint8_t* paletteIndices, size_t count)
+{
+    bool spriteZeroHit = false;
+    size_t i = 0;
+
+#if defined(PIXEL_KERNELS_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i pixelMask = _mm_set1_epi8(0x03);
+    const __m128i indexMask = _mm_set1_epi8(0x0F);
+    const __m128i spriteBase = _mm_set1_epi8(0x10);
+    const __m128i behindFlag = _mm_set1_epi8(SPRITE_BEHIND_BACKGROUND);
+    const __m128i zeroFlag = _mm_set1_epi8(SPRITE_ZERO);
+    __m128i hits = zero;
+
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i backgroundEntries = _mm_loadu_si128(reinterpret_cast<const __m128i*>(background + i));
+        __m128i spriteEntries = _mm_loadu_si128(reinterpret_cast<const __m128i*>(sprites + i));
+
+        // All ones in lanes where the pixel is transparent
+        __m128i backgroundIsClear = _mm_cmpeq_epi8(_mm_and_si128(backgroundEntries, pixelMask), zero);
+        __m128i spriteIsClear = _mm_cmpeq_epi8(_mm_and_si128(spriteEntries, pixelMask), zero);
+        __m128i spriteIsBehind = _mm_cmpeq_epi8(_mm_and_si128(spriteEntries, behindFlag), behindFlag);
+        __m128i isSpriteZero = _mm_cmpeq_epi8(_mm_and_si128(spriteEntries, zeroFlag), zeroFlag);
+
+        __m128i bothOpaque = _mm_andnot_si128(_mm_or_si128(backgroundIsClear, spriteIsClear), _mm_set1_epi8(-1));
+        hits = _mm_or_si128(hits, _mm_and_si128(bothOpaque, isSpriteZero));
+
+        __m128i useSprite = _mm_andnot_si128(_mm_or_si128(spriteIsClear, _mm_and_si128(bothOpaque, spriteIsBehind)), _mm_set1_epi8(-1));
+        __m128i backgroundIndex = _mm_andnot_si128(backgroundIsClear, _mm_and_si128(backgroundEntries, indexMask));
+        __m128i spriteIndex = _mm_or_si128(_mm_and_si128(spriteEntries, indexMask), spriteBase);
+
+        __m128i result = _mm_or_si128(_mm_and_si128(useSprite, spriteIndex), _mm_andnot_si128(useSprite, backgroundIndex));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(paletteIndices + i), result);
+    }
+
+    spriteZeroHit = _mm_movemask_epi8(hits) != 0;
+#endif
+
+    for (; i < count; i++)
+        paletteIndices[i] = MergePixel(background[i], sprites[i], spriteZeroHit);
+
+    return spriteZeroHit;
+}
+
+void PixelKernels::ResolveColours(const uint8_t* paletteIndices, const uint32_t* colours, uint32_t* pixels, size_t count)
+{
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i indices = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(paletteIndices + i)));
+        __m256i result = _mm256_i32gather_epi32(reinterpret_cast<const int*>(colours), indices, 4);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(pixels + i), result);
+    }
+#endif
+
+    for (; i < count; i++)
+        pixels[i] = colours[paletteIndices[i] & 0x1F];
+}
+
+void PixelKernels::ResolveColourIndices(const uint8_t* paletteIndices, const uint8_t* colourIndices, uint8_t* pixels, size_t count)
+{
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    // Byte shuffles look up 16 entries at a time, so look in both halves of the table and pick with bit 4
+    const __m256i lowHalf = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(colourIndices)));
+    const __m256i highHalf = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(colourIndices + 16)));
+    const __m256i highBit = _mm256_set1_epi8(0x10);
+
+    for (; i + 32 <= count; i += 32)
+    {
+        __m256i indices = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(paletteIndices + i));
+        __m256i entry = _mm256_and_si256(indices, _mm256_set1_epi8(0x0F));
+        __m256i useHighHalf = _mm256_cmpeq_epi8(_mm256_and_si256(indices, highBit), highBit);
+
+        __m256i result = _mm256_blendv_epi8(_mm256_shuffle_epi8(lowHalf, entry), _mm256_shuffle_epi8(highHalf, entry), useHighHalf);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(pixels + i), result);
+    }
+#endif
+
+    for (; i < count; i++)
+        pixels[i] = colourIndices[paletteIndices[i] & 0x1F];
+}
+
+void PixelKernels::ConvertColourIndices(const uint8_t* colourIndices, const uint32_t* colours, uint32_t* pixels, size_t count)
+{
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i bytes = _mm_and_si128(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(colourIndices + i)), _mm_set1_epi8(0x3F));
+        __m256i result = _mm256_i32gather_epi32(reinterpret_cast<const int*>(colours), _mm256_cvtepu8_epi32(bytes), 4);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(pixels + i), result);
+    }
+#endif
+
+    for (; i < count; i++)
+        pixels[i] = colours[colourIndices[i] & 0x3F];
+}
+
+void PixelKernels::ConvertColourIndices(const uint8_t* colourIndices, const uint32_t* colours, uint16_t* pixels, size_t count)
+{
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i bytes = _mm_and_si128(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(colourIndices + i)), _mm_set1_epi8(0x3F));
+        __m256i result = _mm256_i32gather_epi32(reinterpret_cast<const int*>(colours), _mm256_cvtepu8_epi32(bytes), 4);
+
+        // The colours fit in 16 bits, so narrowing each lane and gathering the two halves keeps them in order
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(result, result), 0x08);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pixels + i), _mm256_castsi256_si128(packed));
+    }
+#endif
+
+    for (; i < count; i++)
+        pixels[i] = static_cast<uint16_t>(colours[colourIndices[i] & 0x3F]);
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// Data parallel pieces of the scanline renderer. Each has an AVX2 or SSE2 version where the target supports it
+// and a scalar version otherwise, and all of them produce identical results.
+struct PixelKernels
+{
+    // Sprite line entries hold the pixel in bits 0 - 1 and the sprite palette in bits 2 - 3, plus these flags
+    static constexpr uint8_t SPRITE_BEHIND_BACKGROUND = 0x20;
+    static constexpr uint8_t SPRITE_ZERO = 0x40;
+
+    // Expands a tile row's two bit planes into eight 2-bit pixel indices, leftmost first
+    static void DecodeTileRow(uint8_t lowPlane, uint8_t highPlane, bool flipHorizontally, uint8_t* pixels);
+
+    // Combines background entries (palette << 2 | pixel) with sprite line entries into palette RAM indices (0 - 31).
+    // Returns true if an opaque sprite zero pixel landed on an opaque background pixel.
+    static bool MergeScanline(const uint8_t* background, const uint8_t* sprites, uint8_t* paletteIndices, size_t count);
+
+    // Looks palette RAM indices up in a table of 32 resolved colours
+    static void ResolveColours(const uint8_t* paletteIndices, const uint32_t* colours, uint32_t* pixels, size_t count);
+
+    // Looks palette RAM indices up in a table of the 32 colour indices (0 - 63) they currently hold
+    static void ResolveColourIndices(const uint8_t* paletteIndices, const uint8_t* colourIndices, uint8_t* pixels, size_t count);
+
+    // Looks colour indices (0 - 63) up in a table of 64 colours, for 32 bit and 16 bit pixel formats
+    static void ConvertColourIndices(const uint8_t* colourIndices, const uint32_t* colours, uint32_t* pixels, size_t count);
+    static void ConvertColourIndices(const uint8_t* colourIndices, const uint32_t* colours, uint16_t* pixels, size_t count);
+};
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "ppu-bus.h"
+#include "ppu.h"
 
 PpuBus::PpuBus()
 {
@@ -14,45 +15,49 @@ PpuBus::PpuBus()
 
 PpuBus::~PpuBus()
 {
+    if (m_cartridge != nullptr) m_cartridge->SetMirrorModeListener(nullptr);
+}
+
+void PpuBus::ConnectCartridge(std::shared_ptr<Cartridge> cartridge)
+{
+    m_cartridge = cartridge;
+    m_chrBanks = &m_cartridge->GetChrBanks();
+    m_tileCache.Attach(m_cartridge->GetChrMemory().data(), m_cartridge->GetChrMemory().size());
+
+    MapNametables(m_cartridge->GetMirrorMode());
+    m_cartridge->SetMirrorModeListener([this](MirrorMode mirrorMode) { MapNametables(mirrorMode); });
+}
+
+void PpuBus::MapNametables(MirrorMode mirrorMode)
+{
+    switch (mirrorMode)
+    {
+    case MirrorMode::Vertical:
+        m_nametableQuadrants = { m_nameTables[0], m_nameTables[1], m_nameTables[0], m_nameTables[1] };
+        break;
+    case MirrorMode::Horizontal:
+        m_nametableQuadrants = { m_nameTables[0], m_nameTables[0], m_nameTables[1], m_nameTables[1] };
+        break;
+    case MirrorMode::OneScreenLow:
+        m_nametableQuadrants = { m_nameTables[0], m_nameTables[0], m_nameTables[0], m_nameTables[0] };
+        break;
+    case MirrorMode::OneScreenHigh:
+        m_nametableQuadrants = { m_nameTables[1], m_nameTables[1], m_nameTables[1], m_nameTables[1] };
+        break;
+    default:
+        throw std::runtime_error("unsupported mirror mode encoutered while mapping the name tables");
+    }
 }
 
 uint8_t PpuBus::Read(uint16_t address)
 {
     if (address < 0x2000) // Read from cartridge
     {
-        return m_cartridge->PpuRead(address);
+        return (*m_chrBanks)[address / Mapper::CHR_BANK_SIZE][address & (Mapper::CHR_BANK_SIZE - 1)];
     }
     else if (address < 0x3F00) // Read from nametable
     {
-        address &= 0x2FFF; // Convert the 0x3000 range to the 0x2000 range
-
-        switch (m_cartridge->GetMirrorMode())
-        {
-        case MirrorMode::Vertical:
-            if (address < 0x2400)
-                return m_nameTables[0][address & 0x03FF];
-            else if (address < 0x2800)
-                return m_nameTables[1][address & 0x03FF];
-            else if (address < 0x2C00)
-                return m_nameTables[0][address & 0x03FF];
-            else
-                return m_nameTables[1][address & 0x03FF];
-        case MirrorMode::Horizontal:
-            if (address < 0x2400)
-                return m_nameTables[0][address & 0x03FF];
-            else if (address < 0x2800)
-                return m_nameTables[0][address & 0x03FF];
-            else if (address < 0x2C00)
-                return m_nameTables[1][address & 0x03FF];
-            else
-                return m_nameTables[1][address & 0x03FF];
-        case MirrorMode::OneScreenLow:
-            return m_nameTables[0][address & 0x03FF];
-        case MirrorMode::OneScreenHigh:
-            return m_nameTables[1][address & 0x03FF];
-        default:
-            throw std::runtime_error("unsupported mirror mode encoutered while reading from the name table");
-        }
+        return m_nametableQuadrants[(address >> 10) & 3][address & 0x03FF];
     }
     else if (address < 0x4000) // Read from palette RAM
     {
@@ -69,44 +74,14 @@ void PpuBus::Write(uint16_t address, uint8_t data)
 {
     if (address < 0x2000) // Write to cartridge
     {
-        m_cartridge->PpuWrite(address, data);
+        uint8_t* chrData = &(*m_chrBanks)[address / Mapper::CHR_BANK_SIZE][address & (Mapper::CHR_BANK_SIZE - 1)];
+        *chrData = data;
+        m_tileCache.Invalidate(chrData);
         return;
     }
     else if (address < 0x3F00) // Read from nametable
     {
-        address &= 0x2FFF; // Convert the 0x3000 range to the 0x2000 range
-
-        switch (m_cartridge->GetMirrorMode())
-        {
-        case MirrorMode::Vertical:
-            if (address < 0x2400)
-                m_nameTables[0][address & 0x03FF] = data;
-            else if (address < 0x2800)
-                m_nameTables[1][address & 0x03FF] = data;
-            else if (address < 0x2C00)
-                m_nameTables[0][address & 0x03FF] = data;
-            else
-                m_nameTables[1][address & 0x03FF] = data;
-            break;
-        case MirrorMode::Horizontal:
-            if (address < 0x2400)
-                m_nameTables[0][address & 0x03FF] = data;
-            else if (address < 0x2800)
-                m_nameTables[0][address & 0x03FF] = data;
-            else if (address < 0x2C00)
-                m_nameTables[1][address & 0x03FF] = data;
-            else
-                m_nameTables[1][address & 0x03FF] = data;
-            break;
-        case MirrorMode::OneScreenLow:
-            m_nameTables[0][address & 0x03FF] = data;
-            break;
-        case MirrorMode::OneScreenHigh:
-            m_nameTables[1][address & 0x03FF] = data;
-            break;
-        default:
-            throw std::runtime_error("unsupported mirror mode encoutered while reading from the name table");
-        }
+        m_nametableQuadrants[(address >> 10) & 3][address & 0x03FF] = data;
         return;
     }
     else if (address < 0x4000) // Write to palette RAM
@@ -119,3 +94,6 @@ void PpuBus::Write(uint16_t address, uint8_t data)
 
     Logger::GetInstance().Warn("failed to write to PPU bus at address " + Logger::DecmialToHex(address));
 }
+
+// The console PPU is compiled here so the compiler can inline PpuBus reads and writes into it
+template class BasicPPU<PpuBus>;
@@ -7,8 +7,9 @@
 #include "../interfaces/i-bus.h"
 #include "../cartridge/mirror-mode.h"
 #include "../cartridge/cartridge.h"
+#include "chr-tile-cache.h"
 
-class PpuBus : public IBus
+class PpuBus final : public IBus
 {
 public:
 	PpuBus();
@@ -17,9 +18,23 @@ public:
 	uint8_t Read(uint16_t address) override;
 	void Write(uint16_t address, uint8_t data) override;
 
-	void ConnectCartridge(std::shared_ptr<Cartridge> cartridge) { m_cartridge = cartridge; }
+	void ConnectCartridge(std::shared_ptr<Cartridge> cartridge);
+
+	// The decoded pattern row whose low bit plane byte is at the given address (0x0000 - 0x1FFF, bit 3 clear)
+	const ChrTileCache::TileRow& GetPatternRow(uint16_t address, bool flipHorizontally)
+	{
+		const uint8_t* bank = (*m_chrBanks)[address / Mapper::CHR_BANK_SIZE];
+		return m_tileCache.GetRow(bank + (address & (Mapper::CHR_BANK_SIZE - 1)), flipHorizontally);
+	}
 private:
 	std::shared_ptr<Cartridge> m_cartridge;
+	const Mapper::ChrBanks* m_chrBanks = nullptr;	// Owned by the cartridge's mapper, which rewrites it on bank switches
+	ChrTileCache m_tileCache;
 	uint8_t m_nameTables[2][0x400];
+
+	// The physical nametable behind each 1 KB quadrant of 0x2000 - 0x2FFF, rebuilt only when the mirroring changes
+	std::array<uint8_t*, 4> m_nametableQuadrants{};
 	std::array<uint8_t, 0x20> m_paletteMemory;
+
+	void MapNametables(MirrorMode mirrorMode);
 };
\ No newline at end of file
@@ -1,15 +1,20 @@
 #pragma once
 
 #include <cstdint>
+#include <algorithm>
+#include <cstring>
 #include <memory>
 #include <stdexcept>
 
 #include "../debug/logger.h"
-#include "../interfaces/i-bus.h"
 #include "ppu-bus.h"
 #include "colour-palette.h"
+#include "chr-tile-cache.h"
+#include "pixel-kernels.h"
 
-class PPU
+// Bus is the concrete bus type (PpuBus in the console) so memory accesses are direct calls rather than virtual ones
+template <typename Bus>
+class BasicPPU
 {
     union PPUCTRL
     {
@@ -76,14 +81,7 @@ class PPU
         uint8_t attributes;
         uint8_t xPosition;
     };
-
-    struct SpriteFragment
-    {
-        uint8_t patternLowShifter;
-        uint8_t patternHighShifter;
-        uint8_t attributes;
-        uint8_t xPosition;
-    };
+    static_assert(sizeof(ObjectAttribute) == 4, "OAM sprite views must line up with the OAM bytes");
 
     enum class SpriteEvaluationState
     {
@@ -97,35 +95,59 @@ class PPU
         WriteX,
         IncrementOAMIndex,
         StartCheckForSpriteOverflow,
-        CheckForSpriteOverflow
+        CheckForSpriteOverflow,
+        Finished            // Every sprite has been looked at, nothing more happens until the next scanline
     };
 
 public:
     static const uint16_t DISPLAY_WIDTH = 256;
     static const uint16_t DISPLAY_HEIGHT = 240;
 
-    PPU(std::shared_ptr<IBus> bus);
-    ~PPU();
+    BasicPPU(std::shared_ptr<Bus> bus);
+    ~BasicPPU();
 
     void Clock();
     void Reset();
 
-    uint32_t* GetPixelBuffer() { m_frameCompleted = false; return m_pixelBuffer; }
+    // Clocks the PPU until it has run the given number of dots in total. Visible scanlines that fall entirely
+    // inside the range are rendered in one pass since nothing outside the PPU can touch it part way through them.
+    void RunUntil(uint64_t dotCount);
+
+    const uint32_t* GetPixelBuffer() const { return m_pixelBuffer; }
+
+    // Indexed output writes each pixel's colour index (0 - 63, greyscale applied) in place of its RGBA colour,
+    // with the emphasis bits recorded once per scanline as they were for its first pixel. ConvertFrame turns
+    // the indices into colours only when they are needed; the RGBA pixel buffer is left untouched.
+    void SetIndexedOutput(bool enabled) { m_indexedOutput = enabled; }
+    const uint8_t* GetIndexBuffer() const { return m_indexBuffer; }
+    void ConvertFrame(PixelFormat format, void* pixels, size_t pitch) const;
     bool FrameIsComplete() const { return m_frameCompleted; }
+    void ClearFrameComplete() { m_frameCompleted = false; }
     bool NmiInterruptWasRaised();
 
+    // Number of Clock calls until the one that starts vblank, completes the frame or decides the odd frame skip.
+    // Nothing else changes how many dots a frame takes, so the scheduler can sleep until then.
+    uint32_t GetDotsUntilTimingPoint() const;
+
     // Used externally to read and write to the PPU from the CPU bus
     uint8_t Read(uint16_t address);
     void Write(uint16_t address, uint8_t data);
 
+    // Replaces the colours palette RAM entries map to, e.g. with tables from ColourPalette::LoadFromFile
+    void SetColourPalettes(const EmphasisPalettes& palettes);
+
     void WriteByteToOAM(uint8_t address, uint8_t data);
+    void WriteOAM(const uint8_t* data); // Copies a whole 256 byte page into OAM, as a completed OAM DMA would
+
+    // Number of Clock calls until the next one that reads OAM. Until then OAM can change without the PPU noticing.
+    uint32_t GetDotsUntilOamIsRead() const;
     void WriteByteToSecondaryOAM(uint8_t address, uint8_t data);
 
 private:
     static const uint16_t NAMETABLE_BASE = 0x2000;
     static const uint16_t ATTRIBUTE_TABLE_OFFSET = 0x03C0;
 
-    std::shared_ptr<IBus> m_bus;
+    std::shared_ptr<Bus> m_bus;
 
     // Exposed registers
     PPUCTRL m_control;
@@ -149,16 +171,36 @@ private:
     uint16_t m_attributeLowShifter = 0x0000;
     uint16_t m_attributeHighShifter = 0x0000;
 
+    uint64_t m_dotCount = 0;
     short m_scanline = 0;
     short m_dot = 0;
     bool m_oddFrame = false;
 
     uint32_t m_pixelBuffer[DISPLAY_HEIGHT * DISPLAY_WIDTH];
+
+    // The colour each palette RAM entry currently draws as, with PPUMASK's greyscale and emphasis applied. It is
+    // refreshed whenever palette RAM or PPUMASK is written, so pixels never have to go through the bus.
+    EmphasisPalettes m_colourPalettes = DEFAULT_EMPHASIS_PALETTES;
+    uint32_t m_resolvedPalette[32] = {};
+    uint8_t m_resolvedColourIndices[32] = {};
+
+    bool m_indexedOutput = false;
+    alignas(32) uint8_t m_indexBuffer[DISPLAY_HEIGHT * DISPLAY_WIDTH] = {};
+    uint8_t m_lineEmphasis[DISPLAY_HEIGHT] = {};
     bool m_frameCompleted = false;
     bool m_nmiInterruptRaised = false;
 
-    ObjectAttribute m_OAM[64];
-    ObjectAttribute m_secondaryOAM[8];
+    // OAM is kept as the flat bytes the CPU and DMA address, with sprite views over the same memory for rendering
+    union
+    {
+        uint8_t m_oamBytes[256] = {};
+        ObjectAttribute m_OAM[64];
+    };
+    union
+    {
+        uint8_t m_secondaryOAMBytes[32] = {};
+        ObjectAttribute m_secondaryOAM[8];
+    };
     uint8_t m_OAMAddress = 0x00;
 
     SpriteEvaluationState m_spriteEvalState = SpriteEvaluationState::ReadY;
@@ -170,9 +212,9 @@ private:
     bool m_spriteEvalCompleted = true;
 
     uint16_t m_spritePatternAddressBuffer = 0;
-    uint8_t m_spritesOnCurrentScanline = 0;
-    SpriteFragment m_spriteFragments[8];
-    bool m_spriteZeroIsInSpriteFragments = false;
+
+    // Sprite pixels for the next scanline in PixelKernels' sprite line format, drawn as each sprite is fetched
+    alignas(16) uint8_t m_spriteLine[DISPLAY_WIDTH] = {};
 
     uint8_t ReadByteFromOAM(uint8_t address) const;
     uint8_t ReadByteFromSecondaryOAM(uint8_t address) const;
@@ -182,24 +224,40 @@ private:
     inline void WriteToBus(uint16_t address, uint8_t data) { m_bus->Write(address, data); }
 
     void IncrementVramAddress();
+    void RefreshResolvedPalette();
+    void RefreshResolvedPaletteEntry(uint8_t index);
 
     // Rendering helpers
     void PerformTickLogic();
-    uint32_t DeterminePixelColour();
+    uint8_t GetEmphasis() const { return (m_mask.emphasizeBlue << 2) | (m_mask.emphasizeGreen << 1) | m_mask.emphasizeRed; }
+    void OutputPixel(short x, uint8_t paletteIndex);
+    uint8_t DeterminePaletteIndex();
+    uint8_t MixPaletteIndex(short dot, uint8_t backgroundPixel, uint8_t backgroundPalette,
+        uint8_t foregroundPixel, uint8_t foregroundPalette, bool foregroundPriority, bool spriteZeroIsRendering);
+    bool CanRenderScanlineAtOnce() const;
+    void RenderScanline();
     void FetchFromNametable();
     void FetchFromAttributeTable();
     void FetchPatternLeastSignificantBits();
     void FetchPatternMostSignificantBits();
+    uint16_t GetBackgroundPatternAddress() const;
     void IncrementHorizontalPointer();
     void IncrementVerticalPointer();
     void TransferHoriontalPointer();
     void TransferVerticalPointer();
     void LoadShiftersLowByte();
     void ShiftShifters();
-    void ShiftSprites();
     void TickSpriteEvaluation();
+    void EvaluateSprites();
     bool SpriteInRangeOfNextScanline(uint8_t yPosition);
     void TickSpriteFetches();
+    void DrawSpriteToLine(char spriteIndex, const ChrTileCache::TileRow& pixels);
     uint16_t GetSpritePatternAddress(const char& spriteIndex);
-    static void HorizontallyFlipByte(uint8_t& byte);
-};
\ No newline at end of file
+};
+
+#include "ppu.inl"
+
+using PPU = BasicPPU<PpuBus>;
+
+// Compiled once in ppu-bus.cpp
+extern template class BasicPPU<PpuBus>;
\ No newline at end of file
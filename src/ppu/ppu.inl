@@ -0,0 +1,926 @@
+#pragma once
+
+template <typename Bus>
+BasicPPU<Bus>::BasicPPU(std::shared_ptr<Bus> bus) : m_bus(bus)
+{
+    // Set pixel buffer to black
+    for (int i = 0; i < DISPLAY_HEIGHT * DISPLAY_WIDTH; i++) m_pixelBuffer[i] = 0;
+
+    RefreshResolvedPalette();
+}
+
+template <typename Bus>
+BasicPPU<Bus>::~BasicPPU()
+{
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::Clock()
+{
+    m_dotCount++;
+    PerformTickLogic();
+
+    if (m_dot > 0 && m_dot <= DISPLAY_WIDTH && m_scanline >= 0 && m_scanline < DISPLAY_HEIGHT)
+        OutputPixel(m_dot - 1, DeterminePaletteIndex());
+
+    m_dot++;
+    if (m_dot > 340)
+    {
+        m_dot = 0;
+        m_scanline++;
+        if (m_scanline > 260)
+        {
+            m_scanline = -1;
+            m_frameCompleted = true;
+            m_oddFrame = !m_oddFrame;
+        }
+    }
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::RunUntil(uint64_t dotCount)
+{
+    while (m_dotCount < dotCount)
+    {
+        if (CanRenderScanlineAtOnce() && dotCount - m_dotCount >= DISPLAY_WIDTH)
+            RenderScanline();
+        else
+            Clock();
+    }
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::Reset()
+{
+    // TODO
+}
+
+template <typename Bus>
+bool BasicPPU<Bus>::NmiInterruptWasRaised()
+{
+    if (m_nmiInterruptRaised)
+    {
+        m_nmiInterruptRaised = false;
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+template <typename Bus>
+uint32_t BasicPPU<Bus>::GetDotsUntilTimingPoint() const
+{
+    // Positions count dots from the start of the pre-render scanline
+    constexpr int DOTS_PER_SCANLINE = 341;
+    constexpr int TIMING_POINTS[] = {
+        340,                                // Pre-render dot skipped on odd frames
+        (241 + 1) * DOTS_PER_SCANLINE + 1,  // Start of vblank
+        (260 + 1) * DOTS_PER_SCANLINE + 340 // Last dot of the frame
+    };
+
+    int position = (m_scanline + 1) * DOTS_PER_SCANLINE + m_dot;
+    for (int timingPoint : TIMING_POINTS)
+    {
+        if (timingPoint >= position) return timingPoint - position;
+    }
+
+    throw std::runtime_error("unexpected path reached in PPU::GetDotsUntilTimingPoint().");
+}
+
+template <typename Bus>
+uint32_t BasicPPU<Bus>::GetDotsUntilOamIsRead() const
+{
+    // OAM is only read by sprite evaluation, during dots 65 to 256 of each visible scanline
+    constexpr int DOTS_PER_SCANLINE = 341;
+    constexpr int EVALUATION_START = 65;
+    constexpr int EVALUATION_END = 256;
+
+    if (m_scanline >= 0 && m_scanline < DISPLAY_HEIGHT)
+    {
+        if (m_dot <= EVALUATION_START) return EVALUATION_START - m_dot;
+        if (m_dot <= EVALUATION_END) return 0;
+        if (m_scanline < DISPLAY_HEIGHT - 1) return DOTS_PER_SCANLINE - m_dot + EVALUATION_START;
+    }
+
+    // The next read is on scanline 0, which the odd frame skip can bring one dot closer
+    int dotsUntilScanlineZero = DOTS_PER_SCANLINE - m_dot;
+    if (m_scanline >= 0) dotsUntilScanlineZero += (260 - m_scanline) * DOTS_PER_SCANLINE + DOTS_PER_SCANLINE;
+    return dotsUntilScanlineZero + EVALUATION_START - 1;
+}
+
+template <typename Bus>
+uint8_t BasicPPU<Bus>::Read(uint16_t address)
+{
+    uint8_t result = 0x00;
+
+    switch (address)
+    {
+    case 0x2002: // PPUSTATUS
+        m_status.ppuOpenBus = m_readBuffer & 0x1F;
+        result = m_status.byte;
+        m_status.vblank = 0;
+        m_firstWrite = true;
+        return result;
+    case 0x2004: // OAMDATA
+        if (m_scanline < DISPLAY_HEIGHT && m_dot > 0 && m_dot <= 64) return 0xFF;
+        return ReadByteFromOAM(m_OAMAddress);
+    case 0x2007: // PPUDATA
+        result = m_readBuffer;
+        m_readBuffer = ReadFromBus(m_currVramAddress.address);
+        if (m_currVramAddress.address >= 0x3F00) result = m_readBuffer; // Ignore buffer for palette RAM reads
+        IncrementVramAddress();
+        return result;
+    default:
+        Logger::GetInstance().Warn("the CPU attempted to read from the PPU at an invalid address (" + Logger::DecmialToHex(address) + ")");
+        return 0;
+    }
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::Write(uint16_t address, uint8_t data)
+{
+    switch (address)
+    {
+    case 0x2000: // PPUCTRL
+        m_control.byte = data;
+        m_tempVramAddress.nametableX = m_control.nametableX;
+        m_tempVramAddress.nametableY = m_control.nametableY;
+        break;
+    case 0x2001: // PPUMASK
+    {
+        // Only the greyscale and emphasis bits change which colours the palette entries draw as
+        constexpr uint8_t COLOUR_BITS = 0xE1;
+        bool coloursChanged = (m_mask.byte ^ data) & COLOUR_BITS;
+        m_mask.byte = data;
+        if (coloursChanged) RefreshResolvedPalette();
+        break;
+    }
+    case 0x2003: // OAMADDR
+        m_OAMAddress = data;
+        break;
+    case 0x2004: // OAMDATA
+        WriteByteToOAM(m_OAMAddress++, data);
+        break;
+    case 0x2005: // PPUSCROLL
+        if (m_firstWrite)
+        {
+            m_fineXScroll = data & 0x07;
+            m_tempVramAddress.coarseXScroll = data >> 3;
+        }
+        else
+        {
+            m_tempVramAddress.fineYScroll = data & 0x07;
+            m_tempVramAddress.coarseYScroll = data >> 3;
+        }
+        m_firstWrite = !m_firstWrite;
+        break;
+    case 0x2006: // PPUADDR
+        if (m_firstWrite)
+        {
+            m_tempVramAddress.address &= 0x00FF;
+            m_tempVramAddress.address |= (data & 0x3F) << 8;
+        }
+        else
+        {
+            m_tempVramAddress.address &= 0xFF00;
+            m_tempVramAddress.address |= data;
+            m_currVramAddress.address = m_tempVramAddress.address;
+        }
+        m_firstWrite = !m_firstWrite;
+        break;
+    case 0x2007: // PPUDATA
+        WriteToBus(m_currVramAddress.address, data);
+        if (m_currVramAddress.address >= 0x3F00)
+        {
+            // Entry 0 of each sprite palette is shared with the matching background palette
+            uint8_t index = m_currVramAddress.address & 0x1F;
+            RefreshResolvedPaletteEntry(index);
+            if (index % 4 == 0) RefreshResolvedPaletteEntry(index ^ 0x10);
+        }
+        IncrementVramAddress();
+        break;
+    default:
+        Logger::GetInstance().Warn("the CPU attempted to write to the PPU at an invalid address (" + Logger::DecmialToHex(address) + ")");
+        break;
+    }
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::SetColourPalettes(const EmphasisPalettes& palettes)
+{
+    m_colourPalettes = palettes;
+    RefreshResolvedPalette();
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::RefreshResolvedPalette()
+{
+    for (uint8_t index = 0; index < 32; index++)
+        RefreshResolvedPaletteEntry(index);
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::RefreshResolvedPaletteEntry(uint8_t index)
+{
+    uint8_t colour = ReadFromBus(0x3F00 + index) & 0x3F;
+    if (m_mask.greyscale) colour &= 0x30;
+
+    m_resolvedColourIndices[index] = colour;
+    m_resolvedPalette[index] = m_colourPalettes[GetEmphasis()][colour];
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::ConvertFrame(PixelFormat format, void* pixels, size_t pitch) const
+{
+    // Each emphasis combination's colours are converted to the format once, when a scanline first needs them
+    uint32_t colours[8][64];
+    bool converted[8] = {};
+
+    for (int y = 0; y < DISPLAY_HEIGHT; y++)
+    {
+        uint8_t emphasis = m_lineEmphasis[y];
+        if (!converted[emphasis])
+        {
+            for (int colour = 0; colour < 64; colour++)
+                colours[emphasis][colour] = ColourPalette::ConvertColour(m_colourPalettes[emphasis][colour], format);
+            converted[emphasis] = true;
+        }
+
+        const uint8_t* indices = &m_indexBuffer[y * DISPLAY_WIDTH];
+        uint8_t* row = static_cast<uint8_t*>(pixels) + y * pitch;
+        if (format == PixelFormat::RGB565)
+            PixelKernels::ConvertColourIndices(indices, colours[emphasis], reinterpret_cast<uint16_t*>(row), DISPLAY_WIDTH);
+        else
+            PixelKernels::ConvertColourIndices(indices, colours[emphasis], reinterpret_cast<uint32_t*>(row), DISPLAY_WIDTH);
+    }
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::WriteByteToOAM(uint8_t address, uint8_t data)
+{
+    m_oamBytes[address] = data;
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::WriteOAM(const uint8_t* data)
+{
+    std::memcpy(m_oamBytes, data, sizeof(m_oamBytes));
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::WriteByteToSecondaryOAM(uint8_t address, uint8_t data)
+{
+    if (address >= sizeof(m_secondaryOAMBytes))
+    {
+        throw std::runtime_error("address out of bounds for PPU::WriteByteToSecondaryOAM(uint8_t address, uint8_t data)");
+        return;
+    }
+
+    m_secondaryOAMBytes[address] = data;
+}
+
+template <typename Bus>
+uint8_t BasicPPU<Bus>::ReadByteFromOAM(uint8_t address) const
+{
+    return m_oamBytes[address];
+}
+
+template <typename Bus>
+uint8_t BasicPPU<Bus>::ReadByteFromSecondaryOAM(uint8_t address) const
+{
+    if (address >= sizeof(m_secondaryOAMBytes))
+    {
+        throw std::runtime_error("address out of bounds for PPU::ReadByteFromSecondaryOAM(uint8_t address)");
+        return 0;
+    }
+
+    return m_secondaryOAMBytes[address];
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::PerformTickLogic()
+{
+    bool oddFrameCycleSkipped = m_oddFrame && m_scanline == -1 && m_dot == 340
+        && (m_mask.enableBackground || m_mask.enableSprites);
+    if (oddFrameCycleSkipped) m_scanline = m_dot = 0;
+
+    if (m_scanline >= -1 && m_scanline < DISPLAY_HEIGHT) // Rendering scanlines
+    {
+        if (m_dot > 0 && m_dot <= DISPLAY_WIDTH || m_dot >= 321 && m_dot <= 336) // Rendering Cycles
+        {
+            ShiftShifters();
+            switch (m_dot % 8)
+            {
+            case 1:
+                LoadShiftersLowByte();
+                break;
+            case 2:
+                FetchFromNametable();
+                break;
+            case 4:
+                FetchFromAttributeTable();
+                break;
+            case 6:
+                FetchPatternLeastSignificantBits();
+                break;
+            case 0:
+                FetchPatternMostSignificantBits();
+                IncrementHorizontalPointer();
+                break;
+            }
+        }
+
+        if (m_dot == 256) IncrementVerticalPointer();
+        if (m_dot == 257)
+        {
+            LoadShiftersLowByte();
+            TransferHoriontalPointer();
+        }
+
+        // Garbage Nametable Reads
+        if (m_dot > DISPLAY_WIDTH && m_dot <= 320)
+        {
+            if (m_dot % 8 == 2 || m_dot % 8 == 4)
+            {
+                FetchFromNametable();
+            }
+        }
+        if (m_dot == 338 || m_dot == 340 || oddFrameCycleSkipped) FetchFromNametable();
+    }
+
+    if (m_scanline == -1)
+    {
+        if (m_dot == 1)
+        {
+            m_status.vblank = 0;
+            m_status.spriteZeroHit = 0;
+            m_status.spriteOverflow = 0;
+        }
+        if (m_dot >= 280 && m_dot <= 304) TransferVerticalPointer();
+    }
+
+    if (m_scanline == 241 && m_dot == 1)
+    {
+        m_status.vblank = 1;
+        if (m_control.vblankNmi)
+            m_nmiInterruptRaised = true;
+    }
+
+    // Sprite Preparation
+    if (m_scanline >= 0 && m_scanline < DISPLAY_HEIGHT)
+    {
+        // Secondary OAM Clear
+        if (m_dot > 0 && m_dot <= 64 && (m_dot % 2 == 1))
+        {
+            WriteByteToSecondaryOAM(m_dot / 2, 0xFF);
+        }
+
+        if (m_dot > 64 && m_dot <= DISPLAY_WIDTH)
+        {
+            TickSpriteEvaluation();
+        }
+    }
+    if (m_scanline < DISPLAY_HEIGHT && m_dot > DISPLAY_WIDTH && m_dot <= 320)
+    {
+        TickSpriteFetches();
+    }
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::OutputPixel(short x, uint8_t paletteIndex)
+{
+    int pixel = m_scanline * DISPLAY_WIDTH + x;
+    if (!m_indexedOutput)
+    {
+        m_pixelBuffer[pixel] = m_resolvedPalette[paletteIndex];
+        return;
+    }
+
+    m_indexBuffer[pixel] = m_resolvedColourIndices[paletteIndex];
+    if (x == 0) m_lineEmphasis[m_scanline] = GetEmphasis();
+}
+
+template <typename Bus>
+uint8_t BasicPPU<Bus>::DeterminePaletteIndex()
+{
+    // Determine the background pixel in this position
+
+    uint8_t backgroundPixel = 0;
+    uint8_t backgroundPalette = 0;
+
+    if (m_mask.enableBackground)
+    {
+        uint16_t selectedBit = 0x8000 >> m_fineXScroll;
+
+        uint8_t pixelLow = (m_patternLowShifter & selectedBit) != 0;
+        uint8_t pixelHigh = (m_patternHighShifter & selectedBit) != 0;
+        backgroundPixel = (pixelHigh << 1) | pixelLow;
+
+        uint8_t paletteLow = (m_attributeLowShifter & selectedBit) != 0;
+        uint8_t paletteHigh = (m_attributeHighShifter & selectedBit) != 0;
+        backgroundPalette = (paletteHigh << 1) | paletteLow;
+    }
+
+    // Determine the foreground pixel in this position
+
+    uint8_t foregroundPixel = 0;
+    uint8_t foregroundPalette = 0;
+    bool foregroundPriority = 0;
+    bool spriteZeroIsRendering = false;
+
+    if (m_mask.enableSprites)
+    {
+        uint8_t sprite = m_spriteLine[m_dot - 1];
+        foregroundPixel = sprite & 0x03;
+        foregroundPalette = ((sprite >> 2) & 0x03) | 0x04;
+        foregroundPriority = (sprite & PixelKernels::SPRITE_BEHIND_BACKGROUND) == 0;
+        spriteZeroIsRendering = (sprite & PixelKernels::SPRITE_ZERO) != 0;
+    }
+
+    return MixPaletteIndex(m_dot, backgroundPixel, backgroundPalette,
+        foregroundPixel, foregroundPalette, foregroundPriority, spriteZeroIsRendering);
+}
+
+template <typename Bus>
+uint8_t BasicPPU<Bus>::MixPaletteIndex(short dot, uint8_t backgroundPixel, uint8_t backgroundPalette,
+    uint8_t foregroundPixel, uint8_t foregroundPalette, bool foregroundPriority, bool spriteZeroIsRendering)
+{
+    // Determine whether the background or foreground should be rendered
+
+    uint8_t pixel = 0;
+    uint8_t palette = 0;
+
+    if (backgroundPixel != 0 && foregroundPixel != 0)
+    {
+        bool spriteZeroHit = spriteZeroIsRendering
+            && dot != 255
+            && !((!m_mask.showLeftmostSprites || !m_mask.showLeftmostBackground)
+                && dot >= 0 && dot <= 7);
+
+        if (spriteZeroHit) m_status.spriteZeroHit = 1;
+
+        if (foregroundPriority) backgroundPixel = 0;
+        else foregroundPixel = 0;
+    }
+    
+    if (backgroundPixel != 0 && foregroundPixel == 0)
+    {
+        pixel = backgroundPixel;
+        palette = backgroundPalette;
+    }
+    else if (backgroundPixel == 0 && foregroundPixel != 0)
+    {
+        pixel = foregroundPixel;
+        palette = foregroundPalette;
+    }
+
+    return (palette << 2) + pixel;
+}
+
+template <typename Bus>
+bool BasicPPU<Bus>::CanRenderScanlineAtOnce() const
+{
+    // The batched renderer covers dots 1 - 256 of a visible scanline with the background enabled
+    return m_dot == 1 && m_scanline >= 0 && m_scanline < DISPLAY_HEIGHT && m_mask.enableBackground;
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::RenderScanline()
+{
+    // Background entries (palette << 2 | pixel) for every tile fetched this scanline. The first two come from the
+    // end of the last scanline: the first dot's shift leaves bits 14 - 7 of the shifters on top, and the second is latched.
+    alignas(16) uint8_t backgroundTiles[(DISPLAY_WIDTH / 8 + 2) * 8];
+    PixelKernels::DecodeTileRow((m_patternLowShifter >> 7) & 0xFF, (m_patternHighShifter >> 7) & 0xFF, false, backgroundTiles);
+    PixelKernels::DecodeTileRow(m_patternTableTileLow, m_patternTableTileHigh, false, backgroundTiles + 8);
+    uint8_t firstTileAttribute = (((m_attributeHighShifter >> 14) & 1) << 1) | ((m_attributeLowShifter >> 14) & 1);
+    for (int i = 0; i < 8; i++)
+    {
+        backgroundTiles[i] |= firstTileAttribute << 2;
+        backgroundTiles[8 + i] |= m_tileAttribute << 2;
+    }
+
+    for (int tile = 0; tile < DISPLAY_WIDTH / 8; tile++)
+    {
+        // The shifters are no longer drawn from here, but are kept in step for the dot renderer
+        ShiftShifters();
+        LoadShiftersLowByte();
+        m_patternLowShifter <<= 7;
+        m_patternHighShifter <<= 7;
+        m_attributeLowShifter <<= 7;
+        m_attributeHighShifter <<= 7;
+
+        FetchFromNametable();
+        FetchFromAttributeTable();
+        FetchPatternLeastSignificantBits();
+        FetchPatternMostSignificantBits();
+
+        uint8_t* entries = &backgroundTiles[(tile + 2) * 8];
+        std::memcpy(entries, m_bus->GetPatternRow(GetBackgroundPatternAddress(), false).data(), 8);
+        for (int i = 0; i < 8; i++)
+            entries[i] |= m_tileAttribute << 2;
+
+        IncrementHorizontalPointer();
+    }
+
+    // Fine X scrolling picks the starting point within the first tile
+    const uint8_t* backgroundLine = &backgroundTiles[m_fineXScroll];
+
+    // Which sprite zero pixels count depends on PPUMASK as the line is drawn, so they are masked on a copy
+    alignas(16) uint8_t spriteLine[DISPLAY_WIDTH] = {};
+    if (m_mask.enableSprites)
+    {
+        std::memcpy(spriteLine, m_spriteLine, DISPLAY_WIDTH);
+
+        // Sprite zero hits are never reported on dot 255, or on dots 1 - 7 while either left column is hidden
+        spriteLine[DISPLAY_WIDTH - 2] &= ~PixelKernels::SPRITE_ZERO;
+        if (!m_mask.showLeftmostSprites || !m_mask.showLeftmostBackground)
+        {
+            for (int x = 0; x < 7; x++)
+                spriteLine[x] &= ~PixelKernels::SPRITE_ZERO;
+        }
+    }
+
+    alignas(16) uint8_t paletteIndices[DISPLAY_WIDTH];
+    if (PixelKernels::MergeScanline(backgroundLine, spriteLine, paletteIndices, DISPLAY_WIDTH))
+        m_status.spriteZeroHit = 1;
+
+    if (m_indexedOutput)
+    {
+        PixelKernels::ResolveColourIndices(paletteIndices, m_resolvedColourIndices, &m_indexBuffer[m_scanline * DISPLAY_WIDTH], DISPLAY_WIDTH);
+        m_lineEmphasis[m_scanline] = GetEmphasis();
+    }
+    else
+    {
+        PixelKernels::ResolveColours(paletteIndices, m_resolvedPalette, &m_pixelBuffer[m_scanline * DISPLAY_WIDTH], DISPLAY_WIDTH);
+    }
+
+    IncrementVerticalPointer();
+
+    // OAM cannot change part way through the scanline either, so the sprites for the next one are found in one go
+    EvaluateSprites();
+
+    m_dot = DISPLAY_WIDTH + 1;
+    m_dotCount += DISPLAY_WIDTH;
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::FetchFromNametable()
+{
+    m_nametableByte = ReadFromBus(
+        NAMETABLE_BASE
+        | (m_currVramAddress.address & 0x0FFF)
+    );
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::FetchFromAttributeTable()
+{
+    m_tileAttribute = ReadFromBus(
+        NAMETABLE_BASE | ATTRIBUTE_TABLE_OFFSET
+        | (m_currVramAddress.nametableY << 11)
+        | (m_currVramAddress.nametableX << 10)
+        | ((m_currVramAddress.coarseYScroll >> 2) << 3)
+        | (m_currVramAddress.coarseXScroll >> 2)
+    );
+
+    // Shift the 4 tile attribute byte to isolate the current tile (2 bits)
+    if (m_currVramAddress.coarseYScroll & 2) m_tileAttribute >>= 4;
+    if (m_currVramAddress.coarseXScroll & 2) m_tileAttribute >>= 2;
+    m_tileAttribute &= 0b11;
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::FetchPatternLeastSignificantBits()
+{
+    m_patternTableTileLow = ReadFromBus(GetBackgroundPatternAddress());
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::FetchPatternMostSignificantBits()
+{
+    m_patternTableTileHigh = ReadFromBus(GetBackgroundPatternAddress() + 8);
+}
+
+template <typename Bus>
+uint16_t BasicPPU<Bus>::GetBackgroundPatternAddress() const
+{
+    return (m_control.backgroundPatternTable << 12)
+        | (m_nametableByte << 4)
+        | m_currVramAddress.fineYScroll;
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::IncrementVramAddress()
+{
+    if (m_control.vramIncrement)
+        m_currVramAddress.address += 32;
+    else
+        m_currVramAddress.address++;
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::IncrementHorizontalPointer()
+{
+    if (!m_mask.enableBackground && !m_mask.enableSprites) return;
+
+    m_currVramAddress.coarseXScroll++;
+
+    // Flip nametable selector when a coarse X scroll overflow is detected
+    if (m_currVramAddress.coarseXScroll == 0)
+        m_currVramAddress.nametableX = ~m_currVramAddress.nametableX;
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::IncrementVerticalPointer()
+{
+    if (!m_mask.enableBackground && !m_mask.enableSprites) return;
+
+    // Only update fine Y scroll when possible (no overflow)
+    m_currVramAddress.fineYScroll++;
+    if (m_currVramAddress.fineYScroll != 0) return;
+
+    if (m_currVramAddress.coarseYScroll == 29)
+    {
+        // Switch to the next nametable before running in to the attribute table
+        m_currVramAddress.coarseYScroll = 0;
+        m_currVramAddress.nametableY = ~m_currVramAddress.nametableY;
+    }
+    else
+    {
+        m_currVramAddress.coarseYScroll++;
+    }
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::TransferHoriontalPointer()
+{
+    if (!m_mask.enableBackground && !m_mask.enableSprites) return;
+
+    m_currVramAddress.nametableX = m_tempVramAddress.nametableX;
+    m_currVramAddress.coarseXScroll = m_tempVramAddress.coarseXScroll;
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::TransferVerticalPointer()
+{
+    if (!m_mask.enableBackground && !m_mask.enableSprites) return;
+
+    m_currVramAddress.nametableY = m_tempVramAddress.nametableY;
+    m_currVramAddress.coarseYScroll = m_tempVramAddress.coarseYScroll;
+    m_currVramAddress.fineYScroll = m_tempVramAddress.fineYScroll;
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::LoadShiftersLowByte()
+{
+    m_patternLowShifter &= 0xFF00;
+    m_patternLowShifter |= m_patternTableTileLow;
+
+    m_patternHighShifter &= 0xFF00;
+    m_patternHighShifter |= m_patternTableTileHigh;
+
+    m_attributeLowShifter &= 0xFF00;
+    m_attributeLowShifter |= (m_tileAttribute & 1) ? 0xFF : 0;
+
+    m_attributeHighShifter &= 0xFF00;
+    m_attributeHighShifter |= (m_tileAttribute & 2) ? 0xFF : 0;
+
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::ShiftShifters()
+{
+    if (!m_mask.enableBackground) return;
+
+    m_patternLowShifter <<= 1;
+    m_patternHighShifter <<= 1;
+    m_attributeLowShifter <<= 1;
+    m_attributeHighShifter <<= 1;
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::TickSpriteEvaluation()
+{
+    if (m_dot == 65)
+    {
+        if (!m_spriteEvalCompleted)
+        {
+            Logger::GetInstance().Warn(std::format("sprites passed {} were not evaluated on scanline {}", 
+                static_cast<int>(m_spriteEvalOAMIndex), static_cast<int>(m_scanline)));
+        }
+        m_spriteEvalCompleted = false;
+        m_spriteEvalState = SpriteEvaluationState::ReadY;
+        m_spritesFoundDuringEval = 0;
+        m_spriteEvalOAMIndex = 0;
+        m_spriteZeroIsInSecondaryOAM = false;
+    }
+
+    switch (m_spriteEvalState)
+    {
+    case SpriteEvaluationState::ReadY:
+        if (m_dot % 2 == 0) break;
+        m_spriteEvalByteBuffer = m_OAM[m_spriteEvalOAMIndex].yPosition;
+        m_spriteEvalState = SpriteEvaluationState::WriteY;
+        break;
+    case SpriteEvaluationState::WriteY:
+        if (m_spritesFoundDuringEval >= 8)
+        {
+            m_spriteEvalState = SpriteEvaluationState::IncrementOAMIndex;
+            break;
+        }
+        m_secondaryOAM[m_spritesFoundDuringEval].yPosition = m_spriteEvalByteBuffer;
+        if (SpriteInRangeOfNextScanline(m_spriteEvalByteBuffer))
+            m_spriteEvalState = SpriteEvaluationState::ReadTileIndex;
+        else
+            m_spriteEvalState = SpriteEvaluationState::IncrementOAMIndex;
+        break;
+    case SpriteEvaluationState::ReadTileIndex:
+        m_spriteEvalByteBuffer = m_OAM[m_spriteEvalOAMIndex].tileIndex;
+        m_spriteEvalState = SpriteEvaluationState::WriteTileIndex;
+        break;
+    case SpriteEvaluationState::WriteTileIndex:
+        m_secondaryOAM[m_spritesFoundDuringEval].tileIndex = m_spriteEvalByteBuffer;
+        m_spriteEvalState = SpriteEvaluationState::ReadAttributes;
+        break;
+    case SpriteEvaluationState::ReadAttributes:
+        m_spriteEvalByteBuffer = m_OAM[m_spriteEvalOAMIndex].attributes;
+        m_spriteEvalState = SpriteEvaluationState::WriteAttributes;
+        break;
+    case SpriteEvaluationState::WriteAttributes:
+        m_secondaryOAM[m_spritesFoundDuringEval].attributes = m_spriteEvalByteBuffer;
+        m_spriteEvalState = SpriteEvaluationState::ReadX;
+        break;
+    case SpriteEvaluationState::ReadX:
+        m_spriteEvalByteBuffer = m_OAM[m_spriteEvalOAMIndex].xPosition;
+        m_spriteEvalState = SpriteEvaluationState::WriteX;
+        break;
+    case SpriteEvaluationState::WriteX:
+        m_secondaryOAM[m_spritesFoundDuringEval].xPosition = m_spriteEvalByteBuffer;
+        m_spritesFoundDuringEval++;
+        if (m_spriteEvalOAMIndex == 0) m_spriteZeroIsInSecondaryOAM = true;
+        m_spriteEvalState = SpriteEvaluationState::IncrementOAMIndex;
+        break;
+    case SpriteEvaluationState::StartCheckForSpriteOverflow:
+        m_spriteOverflowPointer = m_spriteEvalOAMIndex * 4;
+        m_spriteEvalState = SpriteEvaluationState::CheckForSpriteOverflow;
+        [[fallthrough]];
+    case SpriteEvaluationState::CheckForSpriteOverflow:
+        // This section is intentionally incorrect to match the buggy behaviour of the NES. Sprites that are out of
+        // range advance both the sprite and the byte within it (without carry), so other bytes get treated as Y positions.
+        if (m_dot % 2 == 0) break;
+        if (SpriteInRangeOfNextScanline(m_oamBytes[m_spriteOverflowPointer]))
+        {
+            m_status.spriteOverflow = 1;
+            m_spriteEvalState = SpriteEvaluationState::Finished;
+        }
+        else if (m_spriteOverflowPointer / 4 == 63)
+        {
+            m_spriteEvalState = SpriteEvaluationState::Finished;
+        }
+        else
+        {
+            m_spriteOverflowPointer = (m_spriteOverflowPointer / 4 + 1) * 4 + ((m_spriteOverflowPointer + 1) & 0x03);
+        }
+        m_spriteEvalOAMIndex = m_spriteOverflowPointer / 4;
+        break;
+    case SpriteEvaluationState::Finished:
+        break;
+    }
+
+    if (m_spriteEvalState == SpriteEvaluationState::IncrementOAMIndex)
+    {
+        m_spriteEvalOAMIndex++;
+        if (m_spriteEvalOAMIndex == 64)
+        {
+            m_spriteEvalOAMIndex = 0;
+            m_spriteEvalCompleted = true;
+            m_spriteEvalState = SpriteEvaluationState::Finished;
+        }
+        else if (m_spritesFoundDuringEval < 8)
+        {
+            m_spriteEvalState = SpriteEvaluationState::ReadY;
+        }
+        else
+        {
+            m_spriteEvalCompleted = true;
+            m_spriteEvalState = SpriteEvaluationState::StartCheckForSpriteOverflow;
+        }
+    }
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::EvaluateSprites()
+{
+    // Same outcome as clearing secondary OAM and running TickSpriteEvaluation from dot 65 to 256, which always
+    // gets through all 64 sprites in time
+    std::memset(m_secondaryOAM, 0xFF, sizeof(m_secondaryOAM));
+    m_spritesFoundDuringEval = 0;
+    m_spriteZeroIsInSecondaryOAM = false;
+
+    uint8_t oamIndex = 0;
+    for (; oamIndex < 64 && m_spritesFoundDuringEval < 8; oamIndex++)
+    {
+        // Every Y position is copied to the next free slot, but the slot is only kept if the sprite is in range
+        m_secondaryOAM[m_spritesFoundDuringEval].yPosition = m_OAM[oamIndex].yPosition;
+        if (!SpriteInRangeOfNextScanline(m_OAM[oamIndex].yPosition)) continue;
+
+        m_secondaryOAM[m_spritesFoundDuringEval] = m_OAM[oamIndex];
+        m_spritesFoundDuringEval++;
+        if (oamIndex == 0) m_spriteZeroIsInSecondaryOAM = true;
+    }
+
+    // Look for a ninth sprite with the same diagonal walk through OAM as CheckForSpriteOverflow
+    for (uint8_t byte = 0; oamIndex < 64; oamIndex++, byte = (byte + 1) & 0x03)
+    {
+        if (SpriteInRangeOfNextScanline(m_oamBytes[oamIndex * 4 + byte]))
+        {
+            m_status.spriteOverflow = 1;
+            break;
+        }
+    }
+
+    m_spriteEvalOAMIndex = 0;
+    m_spriteEvalCompleted = true;
+    m_spriteEvalState = SpriteEvaluationState::Finished;
+}
+
+template <typename Bus>
+bool BasicPPU<Bus>::SpriteInRangeOfNextScanline(uint8_t yPosition)
+{
+    short diff = m_scanline - static_cast<short>(yPosition);
+    return diff >= 0 && diff < (m_control.spriteSize ? 16 : 8);
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::TickSpriteFetches()
+{
+    char spriteIndex = (m_dot - DISPLAY_WIDTH) / 8;
+    char fetchCycle = (m_dot - DISPLAY_WIDTH) % 8;
+
+    // The line is drawn from scratch for the sprites found for the next scanline
+    if (m_dot == DISPLAY_WIDTH + 1) std::memset(m_spriteLine, 0, sizeof(m_spriteLine));
+
+    if (spriteIndex >= m_spritesFoundDuringEval) return;
+
+    if (fetchCycle == 5) // Work out where the sprite's row is
+    {
+        m_spritePatternAddressBuffer = GetSpritePatternAddress(spriteIndex);
+    }
+    else if (fetchCycle == 7) // Both bit planes come decoded (and flipped if needed) from the tile cache
+    {
+        DrawSpriteToLine(spriteIndex, m_bus->GetPatternRow(m_spritePatternAddressBuffer, m_secondaryOAM[spriteIndex].attributes & 0x40));
+    }
+}
+
+template <typename Bus>
+void BasicPPU<Bus>::DrawSpriteToLine(char spriteIndex, const ChrTileCache::TileRow& pixels)
+{
+    const ObjectAttribute& sprite = m_secondaryOAM[spriteIndex];
+    uint8_t entry = ((sprite.attributes & 0x03) << 2)
+        | (sprite.attributes & PixelKernels::SPRITE_BEHIND_BACKGROUND)
+        | (spriteIndex == 0 && m_spriteZeroIsInSecondaryOAM ? PixelKernels::SPRITE_ZERO : 0);
+
+    for (int i = 0; i < 8; i++)
+    {
+        int x = sprite.xPosition + i;
+        if (x >= DISPLAY_WIDTH - 1) break;
+
+        // Sprites are fetched in priority order, so pixels already drawn by an earlier sprite win
+        if (pixels[i] == 0 || (m_spriteLine[x] & 0x03) != 0) continue;
+        m_spriteLine[x] = pixels[i] | entry;
+
+        // Sprites are shifted from dot 2 to dot 255, so the last dot repeats the sprite state of the one before it
+        if (x == DISPLAY_WIDTH - 2) m_spriteLine[x + 1] = m_spriteLine[x];
+    }
+}
+
+template <typename Bus>
+uint16_t BasicPPU<Bus>::GetSpritePatternAddress(const char& spriteIndex)
+{
+    bool verticalFlip = m_secondaryOAM[spriteIndex].attributes & 0x80;
+    char diff = m_scanline - m_secondaryOAM[spriteIndex].yPosition;
+
+    uint8_t patternTable;
+    uint8_t cell;
+    uint8_t row;
+
+    if (m_control.spriteSize)
+    {
+        patternTable = m_secondaryOAM[spriteIndex].tileIndex & 0x01;
+        cell = (m_secondaryOAM[spriteIndex].tileIndex & 0xFE) + ((diff < 8) ^ verticalFlip ? 0 : 1);
+    }
+    else
+    {
+        patternTable = m_control.spritePatternTable;
+        cell = m_secondaryOAM[spriteIndex].tileIndex;
+    }
+
+    if (verticalFlip)
+        row = (7 - diff) & 0x07;
+    else 
+        row = diff & 0x07;
+
+    return (patternTable << 12) | (cell << 4) | row;
+}
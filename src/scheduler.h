@@ -0,0 +1,50 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+// Keeps the console's master clock and the time of the next thing each component needs handled.
+// The run loop executes plain CPU cycles until the earliest event is due instead of polling every component each cycle.
+class Scheduler
+{
+public:
+    enum class Event : uint8_t
+    {
+        PpuTiming,  // The PPU reaches vblank, the end of the frame or the pre-render dot where odd frames are shortened
+        OamDma,     // An OAM DMA starts, and stays due until it completes
+        MapperIrq,  // Reserved for mappers that can assert IRQs on a cycle count
+        Count
+    };
+
+    // Master clock ticks per component cycle (NTSC)
+    static constexpr uint64_t MASTER_CYCLES_PER_CPU_CYCLE = 12;
+    static constexpr uint64_t MASTER_CYCLES_PER_PPU_DOT = 4;
+
+    static constexpr uint64_t NEVER = UINT64_MAX;
+
+    Scheduler() { m_eventCycles.fill(NEVER); }
+
+    // The master cycle at the start of the CPU cycle currently being executed
+    uint64_t GetMasterCycle() const { return m_masterCycle; }
+    uint64_t GetCpuCycle() const { return m_masterCycle / MASTER_CYCLES_PER_CPU_CYCLE; }
+    uint64_t GetPpuDot() const { return m_masterCycle / MASTER_CYCLES_PER_PPU_DOT; }
+    void AdvanceCpuCycles(uint64_t cycles) { m_masterCycle += cycles * MASTER_CYCLES_PER_CPU_CYCLE; }
+
+    void Schedule(Event event, uint64_t masterCycle)
+    {
+        m_eventCycles[static_cast<size_t>(event)] = masterCycle;
+        m_nextEventCycle = *std::min_element(m_eventCycles.begin(), m_eventCycles.end());
+    }
+
+    void Cancel(Event event) { Schedule(event, NEVER); }
+
+    bool IsDue(Event event) const { return m_eventCycles[static_cast<size_t>(event)] <= m_masterCycle; }
+    uint64_t GetNextEventCycle() const { return m_nextEventCycle; }
+
+private:
+    uint64_t m_masterCycle = 0;
+    uint64_t m_nextEventCycle = NEVER;
+    std::array<uint64_t, static_cast<size_t>(Event::Count)> m_eventCycles;
+};
\ No newline at end of file
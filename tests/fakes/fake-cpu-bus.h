@@ -1,8 +1,9 @@
 #include <array>
 
 #include "../../src/interfaces/i-bus.h"
+#include "../../src/cpu/cpu.h"
 
-class TestCpuBus : public IBus
+class TestCpuBus final : public IBus
 {
 public:
     TestCpuBus() { m_memory.fill(0); }
@@ -20,4 +21,6 @@ public:
 
 private:
     std::array<uint8_t, 0x10000> m_memory;
-};
\ No newline at end of file
+};
+
+using CPU = BasicCPU<TestCpuBus>;
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include "assembler.h"
+
+Assembler::Assembler(uint16_t origin) : m_origin(origin)
+{
+}
+
+void Assembler::Label(const std::string& name)
+{
+    if (!m_labels.emplace(name, GetAddress()).second)
+        throw std::runtime_error("duplicate assembler label: " + name);
+}
+
+void Assembler::Emit(uint8_t opcode)
+{
+    if (OperandSize(opcode) != 0)
+        throw std::runtime_error(std::format("opcode {:02X} requires an operand", opcode));
+
+    m_output.push_back(opcode);
+}
+
+void Assembler::Emit(uint8_t opcode, uint16_t operand)
+{
+    int operandSize = OperandSize(opcode);
+    if (operandSize == 0)
+        throw std::runtime_error(std::format("opcode {:02X} does not take an operand", opcode));
+    if (operandSize == 1 && operand > 0xFF)
+        throw std::runtime_error(std::format("operand {:04X} does not fit in one byte for opcode {:02X}", operand, opcode));
+
+    m_output.push_back(opcode);
+    m_output.push_back(operand & 0xFF);
+    if (operandSize == 2) m_output.push_back(operand >> 8);
+}
+
+void Assembler::Emit(uint8_t opcode, const std::string& label, uint16_t offset)
+{
+    bool relative = IsBranch(opcode);
+    if (!relative && OperandSize(opcode) != 2)
+        throw std::runtime_error(std::format("opcode {:02X} cannot refer to label {}", opcode, label));
+
+    m_output.push_back(opcode);
+    m_fixups.push_back({ m_output.size(), label, offset, relative });
+    m_output.push_back(0x00);
+    if (!relative) m_output.push_back(0x00);
+}
+
+void Assembler::Data(std::initializer_list<uint8_t> bytes)
+{
+    m_output.insert(m_output.end(), bytes.begin(), bytes.end());
+}
+
+void Assembler::Data(const std::vector<uint8_t>& bytes)
+{
+    m_output.insert(m_output.end(), bytes.begin(), bytes.end());
+}
+
+void Assembler::DataWord(const std::string& label)
+{
+    m_fixups.push_back({ m_output.size(), label, 0, false });
+    m_output.push_back(0x00);
+    m_output.push_back(0x00);
+}
+
+void Assembler::PadTo(uint16_t address, uint8_t fill)
+{
+    if (address < GetAddress())
+        throw std::runtime_error(std::format("assembled code overruns address {:04X}", address));
+
+    m_output.resize(address - m_origin, fill);
+}
+
+std::vector<uint8_t> Assembler::Assemble() const
+{
+    std::vector<uint8_t> result = m_output;
+
+    for (const Fixup& fixup : m_fixups)
+    {
+        auto label = m_labels.find(fixup.label);
+        if (label == m_labels.end())
+            throw std::runtime_error("undefined assembler label: " + fixup.label);
+
+        uint16_t target = label->second + fixup.offset;
+        if (fixup.relative)
+        {
+            int displacement = target - (m_origin + static_cast<int>(fixup.position) + 1);
+            if (displacement < -128 || displacement > 127)
+                throw std::runtime_error("branch out of range to label: " + fixup.label);
+
+            result[fixup.position] = static_cast<uint8_t>(displacement);
+        }
+        else
+        {
+            result[fixup.position] = target & 0xFF;
+            result[fixup.position + 1] = target >> 8;
+        }
+    }
+
+    return result;
+}
+
+int Assembler::OperandSize(uint8_t opcode)
+{
+    // Official opcodes follow an aaabbbcc layout where bbb mostly selects the addressing mode
+    const uint8_t mode = (opcode >> 2) & 0x07;
+    const uint8_t group = opcode & 0x03;
+
+    if (opcode == 0x20) return 2; // JSR
+    if (opcode == 0x00 || opcode == 0x40 || opcode == 0x60) return 0; // BRK, RTI, RTS
+
+    switch (mode)
+    {
+    case 0: return 1;                   // (zp,X) or immediate
+    case 1: return 1;                   // zero page
+    case 2: return group == 1 ? 1 : 0;  // immediate, or implied/accumulator
+    case 3: return 2;                   // absolute
+    case 4: return 1;                   // (zp),Y or relative
+    case 5: return 1;                   // zero page,X
+    case 6: return group == 1 ? 2 : 0;  // absolute,Y, or implied
+    case 7: return 2;                   // absolute,X
+    }
+
+    return 0;
+}
\ No newline at end of file
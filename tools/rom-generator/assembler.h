@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+#include <initializer_list>
+#include <stdexcept>
+#include <format>
+
+// Official 6502 opcodes used by the synthetic ROMs, named after their addressing mode
+struct Op
+{
+    static constexpr uint8_t ADC_IMM = 0x69, ADC_ZP = 0x65, ADC_ABS = 0x6D, ADC_ABX = 0x7D, ADC_IZY = 0x71;
+    static constexpr uint8_t AND_IMM = 0x29, AND_ZP = 0x25;
+    static constexpr uint8_t ASL_ACC = 0x0A, ASL_ZP = 0x06;
+    static constexpr uint8_t BIT_ABS = 0x2C;
+    static constexpr uint8_t BCC = 0x90, BCS = 0xB0, BEQ = 0xF0, BMI = 0x30, BNE = 0xD0, BPL = 0x10, BVC = 0x50, BVS = 0x70;
+    static constexpr uint8_t CLC = 0x18, CLD = 0xD8, SEC = 0x38, SEI = 0x78;
+    static constexpr uint8_t CMP_IMM = 0xC9, CMP_ZP = 0xC5, CPX_IMM = 0xE0, CPY_IMM = 0xC0;
+    static constexpr uint8_t DEC_ZP = 0xC6, DEC_ABX = 0xDE, DEX = 0xCA, DEY = 0x88;
+    static constexpr uint8_t EOR_IMM = 0x49, EOR_ZP = 0x45, EOR_ABX = 0x5D;
+    static constexpr uint8_t INC_ZP = 0xE6, INC_ABX = 0xFE, INX = 0xE8, INY = 0xC8;
+    static constexpr uint8_t JMP_ABS = 0x4C, JSR = 0x20, RTI = 0x40, RTS = 0x60;
+    static constexpr uint8_t LDA_IMM = 0xA9, LDA_ZP = 0xA5, LDA_ZPX = 0xB5, LDA_ABS = 0xAD, LDA_ABX = 0xBD, LDA_ABY = 0xB9, LDA_IZY = 0xB1;
+    static constexpr uint8_t LDX_IMM = 0xA2, LDX_ZP = 0xA6, LDY_IMM = 0xA0, LDY_ZP = 0xA4;
+    static constexpr uint8_t LSR_ACC = 0x4A, LSR_ZP = 0x46;
+    static constexpr uint8_t ORA_IMM = 0x09, ORA_ZP = 0x05;
+    static constexpr uint8_t PHA = 0x48, PLA = 0x68;
+    static constexpr uint8_t ROL_ZP = 0x26, ROR_ACC = 0x6A, ROR_ZP = 0x66;
+    static constexpr uint8_t SBC_IMM = 0xE9;
+    static constexpr uint8_t STA_ZP = 0x85, STA_ZPX = 0x95, STA_ABS = 0x8D, STA_ABX = 0x9D, STA_ABY = 0x99, STA_IZY = 0x91;
+    static constexpr uint8_t STX_ZP = 0x86, STX_ABS = 0x8E, STY_ZP = 0x84;
+    static constexpr uint8_t TAX = 0xAA, TAY = 0xA8, TXA = 0x8A, TXS = 0x9A, TYA = 0x98;
+};
+
+// Minimal two-pass 6502 assembler. Instructions are emitted in order starting at the origin and
+// operands may refer to labels that are defined later; they are resolved when Assemble is called.
+class Assembler
+{
+public:
+    Assembler(uint16_t origin);
+
+    void Label(const std::string& name);
+
+    // Returns a label name that has not been handed out before, for use in reusable code snippets
+    std::string NewLabel(const std::string& prefix) { return std::format("{}_{}", prefix, m_labelCounter++); }
+
+    // Implied and accumulator instructions
+    void Emit(uint8_t opcode);
+
+    // The operand size (one or two bytes) is taken from the opcode's addressing mode
+    void Emit(uint8_t opcode, uint16_t operand);
+
+    // Branches are encoded relative to the label, everything else uses its absolute address
+    void Emit(uint8_t opcode, const std::string& label, uint16_t offset = 0);
+
+    void Data(std::initializer_list<uint8_t> bytes);
+    void Data(const std::vector<uint8_t>& bytes);
+    void DataWord(const std::string& label);
+
+    // Fills with the given byte up to (but not including) address
+    void PadTo(uint16_t address, uint8_t fill = 0xFF);
+
+    uint16_t GetAddress() const { return static_cast<uint16_t>(m_origin + m_output.size()); }
+
+    std::vector<uint8_t> Assemble() const;
+
+private:
+    struct Fixup
+    {
+        size_t position;
+        std::string label;
+        uint16_t offset;
+        bool relative;
+    };
+
+    uint16_t m_origin;
+    std::vector<uint8_t> m_output;
+    std::map<std::string, uint16_t> m_labels;
+    std::vector<Fixup> m_fixups;
+    int m_labelCounter = 0;
+
+    static int OperandSize(uint8_t opcode);
+    static bool IsBranch(uint8_t opcode) { return (opcode & 0x1F) == 0x10; }
+};
\ No newline at end of file
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <stdexcept>
+
+struct INesImage
+{
+    // Builds an iNES 1.0 file. An empty CHR ROM makes the cartridge use 8 KB of CHR RAM.
+    static std::vector<uint8_t> Build(uint8_t mapperId, bool verticalMirroring, const std::vector<uint8_t>& prgRom, const std::vector<uint8_t>& chrRom)
+    {
+        if (prgRom.empty() || prgRom.size() % 0x4000 != 0)
+            throw std::runtime_error("PRG ROM size must be a non-zero multiple of 16 KB.");
+        if (chrRom.size() % 0x2000 != 0)
+            throw std::runtime_error("CHR ROM size must be a multiple of 8 KB.");
+
+        std::vector<uint8_t> image = {
+            'N', 'E', 'S', 0x1A,
+            static_cast<uint8_t>(prgRom.size() / 0x4000),
+            static_cast<uint8_t>(chrRom.size() / 0x2000),
+            static_cast<uint8_t>(((mapperId & 0x0F) << 4) | (verticalMirroring ? 0x01 : 0x00)),
+            static_cast<uint8_t>(mapperId & 0xF0),
+        };
+        image.resize(16, 0x00);
+
+        image.insert(image.end(), prgRom.begin(), prgRom.end());
+        image.insert(image.end(), chrRom.begin(), chrRom.end());
+        return image;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,39 @@
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <stdexcept>
+
+#include "synthetic-roms.h"
+
+// Writes every synthetic ROM as <name>.nes into the given directory
+int main(int argc, char* argv[])
+{
+    if (argc != 2)
+    {
+        std::cerr << "Usage: nes-rom-generator <output directory>" << std::endl;
+        return -1;
+    }
+
+    try
+    {
+        std::filesystem::path outputDirectory(argv[1]);
+        std::filesystem::create_directories(outputDirectory);
+
+        for (const SyntheticRom& rom : SyntheticRoms::All())
+        {
+            std::filesystem::path romPath = outputDirectory / (rom.name + ".nes");
+            std::ofstream file(romPath, std::ios::binary);
+            if (!file.is_open()) throw std::runtime_error("Failed to open file: " + romPath.string());
+
+            file.write(reinterpret_cast<const char*>(rom.image.data()), rom.image.size());
+            std::cout << "Wrote " << romPath.string() << " (" << rom.image.size() << " bytes)" << std::endl;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
\ No newline at end of file
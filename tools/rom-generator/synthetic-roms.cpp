@@ -0,0 +1,804 @@
+#include "synthetic-roms.h"
+
+#include <cmath>
+#include <algorithm>
+
+#include "assembler.h"
+#include "ines-image.h"
+
+// Zero page layout shared by every program
+static constexpr uint8_t ZP_POINTER = 0x00;     // 16-bit pointer used with (zp),Y
+static constexpr uint8_t ZP_FRAME = 0x10;       // Incremented once per NMI
+static constexpr uint8_t ZP_SCRATCH = 0x20;     // Free for program specific state
+
+static constexpr uint16_t OAM_PAGE = 0x0200;
+
+static constexpr uint16_t PPUCTRL = 0x2000;
+static constexpr uint16_t PPUMASK = 0x2001;
+static constexpr uint16_t PPUSTATUS = 0x2002;
+static constexpr uint16_t OAMADDR = 0x2003;
+static constexpr uint16_t PPUSCROLL = 0x2005;
+static constexpr uint16_t PPUADDR = 0x2006;
+static constexpr uint16_t PPUDATA = 0x2007;
+static constexpr uint16_t OAMDMA = 0x4014;
+static constexpr uint16_t APU_STATUS = 0x4015;
+static constexpr uint16_t APU_FRAME_COUNTER = 0x4017;
+
+// Small xorshift generator so the data tables are identical on every platform
+class DataGenerator
+{
+public:
+    DataGenerator(uint32_t seed) : m_state(seed) {}
+
+    uint8_t Next()
+    {
+        m_state ^= m_state << 13;
+        m_state ^= m_state >> 17;
+        m_state ^= m_state << 5;
+        return static_cast<uint8_t>(m_state);
+    }
+
+    std::vector<uint8_t> Bytes(size_t count)
+    {
+        std::vector<uint8_t> bytes(count);
+        for (uint8_t& byte : bytes) byte = Next();
+        return bytes;
+    }
+
+private:
+    uint32_t m_state;
+};
+
+// Tile 0 is transparent and tile 1 is solid in every 4 KB pattern table so sprite zero hits are
+// predictable. The remaining tiles are noise with a different seed per pattern table.
+static std::vector<uint8_t> BuildPatternTables(size_t size, uint32_t seed)
+{
+    DataGenerator generator(seed);
+    std::vector<uint8_t> chr = generator.Bytes(size);
+
+    for (size_t table = 0; table < size; table += 0x1000)
+    {
+        std::fill_n(chr.begin() + table, 16, 0x00);
+        std::fill_n(chr.begin() + table + 16, 8, 0xFF);
+        std::fill_n(chr.begin() + table + 24, 8, 0x00);
+    }
+
+    return chr;
+}
+
+static std::vector<uint8_t> BuildPalette()
+{
+    std::vector<uint8_t> palette(32);
+    for (int i = 0; i < 32; i++)
+        palette[i] = (i % 4 == 0) ? 0x0F : static_cast<uint8_t>((i * 7 + 1) & 0x3F);
+    return palette;
+}
+
+static void EmitWaitForVblank(Assembler& a)
+{
+    std::string wait = a.NewLabel("wait_vblank");
+    a.Label(wait);
+    a.Emit(Op::BIT_ABS, PPUSTATUS);
+    a.Emit(Op::BPL, wait);
+}
+
+// Standard power-up sequence: disable rendering and APU IRQs, clear RAM, hide all sprites
+// and wait for the PPU to warm up. Leaves X = 0.
+static void EmitResetPreamble(Assembler& a)
+{
+    a.Emit(Op::SEI);
+    a.Emit(Op::CLD);
+    a.Emit(Op::LDX_IMM, 0xFF);
+    a.Emit(Op::TXS);
+    a.Emit(Op::INX);
+    a.Emit(Op::STX_ABS, PPUCTRL);
+    a.Emit(Op::STX_ABS, PPUMASK);
+    a.Emit(Op::STX_ABS, 0x4010);
+    a.Emit(Op::LDA_IMM, 0x40);
+    a.Emit(Op::STA_ABS, APU_FRAME_COUNTER);
+    a.Emit(Op::BIT_ABS, PPUSTATUS);
+    EmitWaitForVblank(a);
+
+    std::string clear = a.NewLabel("clear_ram");
+    a.Label(clear);
+    a.Emit(Op::LDA_IMM, 0x00);
+    a.Emit(Op::STA_ZPX, 0x00);
+    for (uint16_t page = 0x0100; page < 0x0800; page += 0x0100)
+    {
+        if (page != OAM_PAGE) a.Emit(Op::STA_ABX, page);
+    }
+    a.Emit(Op::LDA_IMM, 0xFF);
+    a.Emit(Op::STA_ABX, OAM_PAGE);
+    a.Emit(Op::INX);
+    a.Emit(Op::BNE, clear);
+
+    EmitWaitForVblank(a);
+}
+
+static void EmitSetPpuAddress(Assembler& a, uint16_t address)
+{
+    a.Emit(Op::LDA_ABS, PPUSTATUS);
+    a.Emit(Op::LDA_IMM, address >> 8);
+    a.Emit(Op::STA_ABS, PPUADDR);
+    a.Emit(Op::LDA_IMM, address & 0xFF);
+    a.Emit(Op::STA_ABS, PPUADDR);
+}
+
+static void EmitUploadPalette(Assembler& a, const std::string& paletteLabel)
+{
+    EmitSetPpuAddress(a, 0x3F00);
+
+    std::string loop = a.NewLabel("palette");
+    a.Emit(Op::LDX_IMM, 0x00);
+    a.Label(loop);
+    a.Emit(Op::LDA_ABX, paletteLabel);
+    a.Emit(Op::STA_ABS, PPUDATA);
+    a.Emit(Op::INX);
+    a.Emit(Op::CPX_IMM, 0x20);
+    a.Emit(Op::BNE, loop);
+}
+
+// Fills both physical nametables (including attributes) with an incrementing tile pattern
+static void EmitFillNametables(Assembler& a)
+{
+    EmitSetPpuAddress(a, 0x2000);
+
+    std::string loop = a.NewLabel("nametable");
+    a.Emit(Op::LDY_IMM, 0x08);
+    a.Emit(Op::LDX_IMM, 0x00);
+    a.Label(loop);
+    a.Emit(Op::STX_ABS, PPUDATA);
+    a.Emit(Op::INX);
+    a.Emit(Op::BNE, loop);
+    a.Emit(Op::DEY);
+    a.Emit(Op::BNE, loop);
+}
+
+// Writes value to count (1 - 256) consecutive PPU addresses
+static void EmitFillPpu(Assembler& a, uint16_t address, int count, uint8_t value)
+{
+    EmitSetPpuAddress(a, address);
+
+    std::string loop = a.NewLabel("fill_ppu");
+    a.Emit(Op::LDA_IMM, value);
+    a.Emit(Op::LDX_IMM, count & 0xFF);
+    a.Label(loop);
+    a.Emit(Op::STA_ABS, PPUDATA);
+    a.Emit(Op::DEX);
+    a.Emit(Op::BNE, loop);
+}
+
+static void EmitResetScroll(Assembler& a, uint8_t control)
+{
+    a.Emit(Op::LDA_ABS, PPUSTATUS);
+    a.Emit(Op::LDA_IMM, 0x00);
+    a.Emit(Op::STA_ABS, PPUSCROLL);
+    a.Emit(Op::STA_ABS, PPUSCROLL);
+    a.Emit(Op::LDA_IMM, control);
+    a.Emit(Op::STA_ABS, PPUCTRL);
+}
+
+static void EmitEnableRendering(Assembler& a, uint8_t control, uint8_t mask)
+{
+    EmitResetScroll(a, control);
+    a.Emit(Op::LDA_IMM, mask);
+    a.Emit(Op::STA_ABS, PPUMASK);
+}
+
+static void EmitOamDma(Assembler& a)
+{
+    a.Emit(Op::LDA_IMM, 0x00);
+    a.Emit(Op::STA_ABS, OAMADDR);
+    a.Emit(Op::LDA_IMM, OAM_PAGE >> 8);
+    a.Emit(Op::STA_ABS, OAMDMA);
+}
+
+static void EmitWaitForNextFrame(Assembler& a)
+{
+    std::string wait = a.NewLabel("wait_frame");
+    a.Emit(Op::LDA_ZP, ZP_FRAME);
+    a.Label(wait);
+    a.Emit(Op::CMP_ZP, ZP_FRAME);
+    a.Emit(Op::BEQ, wait);
+}
+
+static void EmitSaveRegisters(Assembler& a)
+{
+    a.Emit(Op::PHA);
+    a.Emit(Op::TXA);
+    a.Emit(Op::PHA);
+    a.Emit(Op::TYA);
+    a.Emit(Op::PHA);
+}
+
+static void EmitRestoreRegistersAndReturn(Assembler& a)
+{
+    a.Emit(Op::PLA);
+    a.Emit(Op::TAY);
+    a.Emit(Op::PLA);
+    a.Emit(Op::TAX);
+    a.Emit(Op::PLA);
+    a.Emit(Op::RTI);
+}
+
+// Bank switches on discrete logic mappers write through a table holding the bank number to avoid bus conflicts
+static void EmitSwitchBankFromTable(Assembler& a, const std::string& bankTableLabel)
+{
+    a.Emit(Op::TAY);
+    a.Emit(Op::LDA_ABY, bankTableLabel);
+    a.Emit(Op::STA_ABY, bankTableLabel);
+}
+
+// MMC1 registers are loaded serially, one bit per write, from A
+static void EmitMmc1Write(Assembler& a, uint16_t registerAddress)
+{
+    for (int i = 0; i < 5; i++)
+    {
+        a.Emit(Op::STA_ABS, registerAddress);
+        if (i < 4) a.Emit(Op::LSR_ACC);
+    }
+}
+
+static void EmitVectors(Assembler& a, const std::string& nmi, const std::string& reset, const std::string& irq)
+{
+    a.PadTo(0xFFFA);
+    a.DataWord(nmi);
+    a.DataWord(reset);
+    a.DataWord(irq);
+}
+
+SyntheticRom SyntheticRoms::CpuLoop()
+{
+    Assembler a(0x8000);
+
+    a.Label("reset");
+    EmitResetPreamble(a);
+    EmitUploadPalette(a, "palette");
+    EmitFillNametables(a);
+
+    a.Emit(Op::LDA_IMM, 0x00);
+    a.Emit(Op::STA_ZP, ZP_POINTER);
+    a.Emit(Op::LDA_IMM, 0x05);
+    a.Emit(Op::STA_ZP, ZP_POINTER + 1);
+    EmitEnableRendering(a, 0x80, 0x0A);
+
+    a.Label("main");
+    a.Emit(Op::LDX_IMM, 0x00);
+    a.Label("mix");
+    a.Emit(Op::LDA_ABX, 0x0300);
+    a.Emit(Op::ADC_ZP, ZP_SCRATCH);
+    a.Emit(Op::STA_ABX, 0x0300);
+    a.Emit(Op::EOR_ABX, 0x0400);
+    a.Emit(Op::STA_ABX, 0x0400);
+    a.Emit(Op::ROL_ZP, ZP_SCRATCH + 1);
+    a.Emit(Op::INX);
+    a.Emit(Op::BNE, "mix");
+
+    a.Emit(Op::JSR, "multiply");
+    a.Emit(Op::INC_ZP, ZP_SCRATCH + 2);
+    a.Emit(Op::DEC_ZP, ZP_SCRATCH + 3);
+
+    a.Emit(Op::LDY_IMM, 0x00);
+    a.Label("indirect");
+    a.Emit(Op::LDA_IZY, ZP_POINTER);
+    a.Emit(Op::CLC);
+    a.Emit(Op::ADC_IMM, 0x01);
+    a.Emit(Op::STA_IZY, ZP_POINTER);
+    a.Emit(Op::INY);
+    a.Emit(Op::CPY_IMM, 0x40);
+    a.Emit(Op::BNE, "indirect");
+    a.Emit(Op::JMP_ABS, "main");
+
+    // 8x8 -> 16 bit shift and add multiply of the two scratch counters
+    a.Label("multiply");
+    a.Emit(Op::LDA_ZP, ZP_SCRATCH + 3);
+    a.Emit(Op::STA_ZP, ZP_SCRATCH + 4);
+    a.Emit(Op::LDA_IMM, 0x00);
+    a.Emit(Op::LDX_IMM, 0x08);
+    a.Label("multiply_bit");
+    a.Emit(Op::LSR_ZP, ZP_SCRATCH + 4);
+    a.Emit(Op::BCC, "multiply_skip");
+    a.Emit(Op::CLC);
+    a.Emit(Op::ADC_ZP, ZP_SCRATCH + 2);
+    a.Label("multiply_skip");
+    a.Emit(Op::ROR_ACC);
+    a.Emit(Op::ROR_ZP, ZP_SCRATCH + 5);
+    a.Emit(Op::DEX);
+    a.Emit(Op::BNE, "multiply_bit");
+    a.Emit(Op::STA_ZP, ZP_SCRATCH + 6);
+    a.Emit(Op::RTS);
+
+    a.Label("nmi");
+    a.Emit(Op::INC_ZP, ZP_FRAME);
+    a.Label("irq");
+    a.Emit(Op::RTI);
+
+    a.Label("palette");
+    a.Data(BuildPalette());
+
+    EmitVectors(a, "nmi", "reset", "irq");
+
+    return { "cpu-loop", INesImage::Build(0, true, a.Assemble(), BuildPatternTables(0x2000, 0x1234)) };
+}
+
+SyntheticRom SyntheticRoms::PpuTraffic()
+{
+    constexpr int BANK_COUNT = 8;
+    constexpr int VBLANK_UPLOAD_SIZE = 0x40;
+
+    // Fixed bank at $C000, the seven switchable banks hold tile and nametable data
+    Assembler a(0xC000);
+
+    a.Label("reset");
+    EmitResetPreamble(a);
+
+    // Copy the first 8 KB of bank 0 into CHR RAM
+    a.Emit(Op::LDA_IMM, 0x00);
+    EmitSwitchBankFromTable(a, "banks");
+    EmitSetPpuAddress(a, 0x0000);
+    a.Emit(Op::STA_ZP, ZP_POINTER);
+    a.Emit(Op::LDA_IMM, 0x80);
+    a.Emit(Op::STA_ZP, ZP_POINTER + 1);
+    a.Emit(Op::LDX_IMM, 0x20);
+    a.Emit(Op::LDY_IMM, 0x00);
+    a.Label("chr_upload");
+    a.Emit(Op::LDA_IZY, ZP_POINTER);
+    a.Emit(Op::STA_ABS, PPUDATA);
+    a.Emit(Op::INY);
+    a.Emit(Op::BNE, "chr_upload");
+    a.Emit(Op::INC_ZP, ZP_POINTER + 1);
+    a.Emit(Op::DEX);
+    a.Emit(Op::BNE, "chr_upload");
+
+    EmitUploadPalette(a, "palette");
+    EmitFillNametables(a);
+
+    a.Label("oam_init");
+    a.Emit(Op::TXA);
+    a.Emit(Op::STA_ABX, OAM_PAGE);
+    a.Emit(Op::INX);
+    a.Emit(Op::BNE, "oam_init");
+
+    EmitEnableRendering(a, 0x88, 0x1E);
+
+    // Move every sprite diagonally and wait for the NMI. Every fourth frame the screen is then
+    // blanked and a whole nametable is streamed in, the NMI turns rendering back on.
+    a.Label("main");
+    a.Emit(Op::LDX_IMM, 0x00);
+    a.Label("move_sprites");
+    a.Emit(Op::INC_ABX, OAM_PAGE + 3);
+    a.Emit(Op::LDA_ABX, OAM_PAGE);
+    a.Emit(Op::CLC);
+    a.Emit(Op::ADC_IMM, 0x01);
+    a.Emit(Op::STA_ABX, OAM_PAGE);
+    a.Emit(Op::TXA);
+    a.Emit(Op::CLC);
+    a.Emit(Op::ADC_IMM, 0x04);
+    a.Emit(Op::TAX);
+    a.Emit(Op::BNE, "move_sprites");
+    EmitWaitForNextFrame(a);
+    a.Emit(Op::LDA_ZP, ZP_FRAME);
+    a.Emit(Op::AND_IMM, 0x03);
+    a.Emit(Op::BNE, "main");
+
+    a.Emit(Op::LDA_IMM, 0x00);
+    a.Emit(Op::STA_ABS, PPUMASK);
+    EmitSetPpuAddress(a, 0x2800);
+    a.Emit(Op::STA_ZP, ZP_POINTER);
+    a.Emit(Op::LDA_IMM, 0x84);
+    a.Emit(Op::STA_ZP, ZP_POINTER + 1);
+    a.Emit(Op::LDX_IMM, 0x04);
+    a.Emit(Op::LDY_IMM, 0x00);
+    a.Label("forced_blank_upload");
+    a.Emit(Op::LDA_IZY, ZP_POINTER);
+    a.Emit(Op::STA_ABS, PPUDATA);
+    a.Emit(Op::INY);
+    a.Emit(Op::BNE, "forced_blank_upload");
+    a.Emit(Op::INC_ZP, ZP_POINTER + 1);
+    a.Emit(Op::DEX);
+    a.Emit(Op::BNE, "forced_blank_upload");
+    a.Emit(Op::JMP_ABS, "main");
+
+    // Everything in the handler fits inside vblank
+    a.Label("nmi");
+    EmitSaveRegisters(a);
+    EmitOamDma(a);
+
+    // Stream part of a switched bank into one of the nametables
+    a.Emit(Op::LDA_ZP, ZP_FRAME);
+    a.Emit(Op::AND_IMM, 0x03);
+    EmitSwitchBankFromTable(a, "banks");
+    a.Emit(Op::LDA_ABS, PPUSTATUS);
+    a.Emit(Op::LDA_ZP, ZP_FRAME);
+    a.Emit(Op::AND_IMM, 0x03);
+    a.Emit(Op::ORA_IMM, 0x20);
+    a.Emit(Op::STA_ABS, PPUADDR);
+    a.Emit(Op::LDA_IMM, 0x00);
+    a.Emit(Op::STA_ABS, PPUADDR);
+    a.Emit(Op::LDX_IMM, 0x00);
+    a.Label("nametable_upload");
+    a.Emit(Op::LDA_ABX, 0x8000);
+    a.Emit(Op::STA_ABS, PPUDATA);
+    a.Emit(Op::INX);
+    a.Emit(Op::CPX_IMM, VBLANK_UPLOAD_SIZE);
+    a.Emit(Op::BNE, "nametable_upload");
+
+    EmitUploadPalette(a, "palette");
+
+    // Read back part of an attribute table through the PPUDATA read buffer
+    EmitSetPpuAddress(a, 0x23C0);
+    a.Emit(Op::LDX_IMM, 0x08);
+    a.Label("attribute_read");
+    a.Emit(Op::LDA_ABS, PPUDATA);
+    a.Emit(Op::DEX);
+    a.Emit(Op::BNE, "attribute_read");
+
+    EmitResetScroll(a, 0x88);
+    a.Emit(Op::LDA_IMM, 0x1E);
+    a.Emit(Op::STA_ABS, PPUMASK);
+    a.Emit(Op::INC_ZP, ZP_FRAME);
+    EmitRestoreRegistersAndReturn(a);
+
+    a.Label("irq");
+    a.Emit(Op::RTI);
+
+    a.Label("banks");
+    for (int bank = 0; bank < BANK_COUNT; bank++)
+        a.Data({ static_cast<uint8_t>(bank) });
+
+    a.Label("palette");
+    a.Data(BuildPalette());
+
+    EmitVectors(a, "nmi", "reset", "irq");
+
+    DataGenerator generator(0x5A17);
+    std::vector<uint8_t> prgRom = generator.Bytes(0x4000 * (BANK_COUNT - 1));
+    std::vector<uint8_t> fixedBank = a.Assemble();
+    prgRom.insert(prgRom.end(), fixedBank.begin(), fixedBank.end());
+
+    return { "ppu-traffic", INesImage::Build(2, false, prgRom, {}) };
+}
+
+SyntheticRom SyntheticRoms::ScrollSplit()
+{
+    constexpr int BANK_COUNT = 8;
+    constexpr uint16_t RESET_STUB = 0xFF00;
+    constexpr uint8_t STATUS_BAR_SPRITE_Y = 0x18;
+
+    // MMC1 may power up with any 16 KB bank at $C000, so every bank ends with the same stub
+    // that resets the mapper (fixing the last bank at $C000) and jumps into the fixed bank.
+    Assembler a(0xC000);
+
+    a.Label("reset");
+    EmitResetPreamble(a);
+
+    a.Emit(Op::LDA_IMM, 0x1E); // 4 KB CHR banks, fixed last PRG bank, vertical mirroring
+    EmitMmc1Write(a, 0x8000);
+    a.Emit(Op::LDA_IMM, 0x00);
+    EmitMmc1Write(a, 0xA000);
+    a.Emit(Op::LDA_IMM, 0x01);
+    EmitMmc1Write(a, 0xC000);
+    a.Emit(Op::LDA_IMM, 0x00);
+    EmitMmc1Write(a, 0xE000);
+
+    EmitUploadPalette(a, "palette");
+    EmitFillNametables(a);
+    EmitFillPpu(a, 0x2000, 0x80, 0x01); // Solid status bar behind sprite zero
+
+    a.Emit(Op::LDX_IMM, 0x00);
+    a.Label("sprite_zero");
+    a.Emit(Op::LDA_ABX, "sprite_zero_data");
+    a.Emit(Op::STA_ABX, OAM_PAGE);
+    a.Emit(Op::INX);
+    a.Emit(Op::CPX_IMM, 0x04);
+    a.Emit(Op::BNE, "sprite_zero");
+
+    EmitEnableRendering(a, 0x88, 0x1E);
+
+    // Wait for the previous frame's hit to clear, then for sprite zero to hit below the status bar
+    a.Label("main");
+    a.Emit(Op::BIT_ABS, PPUSTATUS);
+    a.Emit(Op::BVS, "main");
+    a.Label("wait_hit");
+    a.Emit(Op::BIT_ABS, PPUSTATUS);
+    a.Emit(Op::BVC, "wait_hit");
+
+    a.Emit(Op::LDA_ZP, ZP_FRAME);
+    a.Emit(Op::STA_ABS, PPUSCROLL);
+    a.Emit(Op::LDA_IMM, 0x00);
+    a.Emit(Op::STA_ABS, PPUSCROLL);
+
+    // Swap the playfield's pattern table and the switchable PRG bank
+    a.Emit(Op::LDA_ZP, ZP_FRAME);
+    a.Emit(Op::AND_IMM, 0x03);
+    a.Emit(Op::CLC);
+    a.Emit(Op::ADC_IMM, 0x02);
+    EmitMmc1Write(a, 0xA000);
+    a.Emit(Op::LDA_ZP, ZP_FRAME);
+    a.Emit(Op::AND_IMM, 0x03);
+    EmitMmc1Write(a, 0xE000);
+
+    // Checksum a page from the switched bank
+    a.Emit(Op::LDX_IMM, 0x00);
+    a.Emit(Op::LDA_IMM, 0x00);
+    a.Label("checksum");
+    a.Emit(Op::CLC);
+    a.Emit(Op::ADC_ABX, 0x8000);
+    a.Emit(Op::INX);
+    a.Emit(Op::BNE, "checksum");
+    a.Emit(Op::STA_ZP, ZP_SCRATCH);
+
+    EmitWaitForNextFrame(a);
+    a.Emit(Op::JMP_ABS, "main");
+
+    a.Label("nmi");
+    EmitSaveRegisters(a);
+    EmitOamDma(a);
+    EmitResetScroll(a, 0x88);
+    a.Emit(Op::LDA_IMM, 0x00);
+    EmitMmc1Write(a, 0xA000);
+    a.Emit(Op::INC_ZP, ZP_FRAME);
+    EmitRestoreRegistersAndReturn(a);
+
+    a.Label("irq");
+    a.Emit(Op::RTI);
+
+    a.Label("sprite_zero_data");
+    a.Data({ STATUS_BAR_SPRITE_Y, 0x01, 0x00, 0x40 });
+
+    a.Label("palette");
+    a.Data(BuildPalette());
+
+    a.PadTo(RESET_STUB);
+    a.Label("reset_stub");
+    a.Emit(Op::SEI);
+    a.Emit(Op::LDA_IMM, 0x80);
+    a.Emit(Op::STA_ABS, 0x8000);
+    a.Emit(Op::JMP_ABS, "reset");
+
+    EmitVectors(a, "nmi", "reset_stub", "irq");
+
+    std::vector<uint8_t> fixedBank = a.Assemble();
+
+    DataGenerator generator(0x3C0F);
+    std::vector<uint8_t> prgRom;
+    for (int bank = 0; bank < BANK_COUNT - 1; bank++)
+    {
+        std::vector<uint8_t> data = generator.Bytes(RESET_STUB - 0xC000);
+        prgRom.insert(prgRom.end(), data.begin(), data.end());
+        prgRom.insert(prgRom.end(), fixedBank.begin() + (RESET_STUB - 0xC000), fixedBank.end());
+    }
+    prgRom.insert(prgRom.end(), fixedBank.begin(), fixedBank.end());
+
+    return { "scroll-split", INesImage::Build(1, true, prgRom, BuildPatternTables(0x8000, 0x77E1)) };
+}
+
+SyntheticRom SyntheticRoms::SpriteHeavy()
+{
+    constexpr int BANK_COUNT = 4;
+
+    Assembler a(0x8000);
+
+    a.Label("reset");
+    EmitResetPreamble(a);
+    a.Emit(Op::LDA_IMM, 0x00);
+    EmitSwitchBankFromTable(a, "banks");
+    EmitUploadPalette(a, "palette");
+    EmitFillNametables(a);
+
+    a.Emit(Op::LDX_IMM, 0x00);
+    a.Label("oam_init");
+    a.Emit(Op::LDA_ABX, "sprites");
+    a.Emit(Op::STA_ABX, OAM_PAGE);
+    a.Emit(Op::INX);
+    a.Emit(Op::BNE, "oam_init");
+
+    EmitEnableRendering(a, 0xA0, 0x1E);
+
+    // Each sprite moves right at 1-4 pixels per frame and bobs vertically every 16 frames
+    a.Label("main");
+    a.Emit(Op::LDX_IMM, 0x00);
+    a.Label("move_sprites");
+    a.Emit(Op::TXA);
+    a.Emit(Op::LSR_ACC);
+    a.Emit(Op::LSR_ACC);
+    a.Emit(Op::AND_IMM, 0x03);
+    a.Emit(Op::SEC);
+    a.Emit(Op::ADC_ABX, OAM_PAGE + 3);
+    a.Emit(Op::STA_ABX, OAM_PAGE + 3);
+    a.Emit(Op::LDA_ZP, ZP_FRAME);
+    a.Emit(Op::AND_IMM, 0x10);
+    a.Emit(Op::BEQ, "move_down");
+    a.Emit(Op::DEC_ABX, OAM_PAGE);
+    a.Emit(Op::JMP_ABS, "next_sprite");
+    a.Label("move_down");
+    a.Emit(Op::INC_ABX, OAM_PAGE);
+    a.Label("next_sprite");
+    a.Emit(Op::TXA);
+    a.Emit(Op::CLC);
+    a.Emit(Op::ADC_IMM, 0x04);
+    a.Emit(Op::TAX);
+    a.Emit(Op::BNE, "move_sprites");
+    EmitWaitForNextFrame(a);
+    a.Emit(Op::JMP_ABS, "main");
+
+    a.Label("nmi");
+    EmitSaveRegisters(a);
+    EmitOamDma(a);
+    a.Emit(Op::LDA_ZP, ZP_FRAME);
+    a.Emit(Op::LSR_ACC);
+    a.Emit(Op::LSR_ACC);
+    a.Emit(Op::LSR_ACC);
+    a.Emit(Op::AND_IMM, BANK_COUNT - 1);
+    EmitSwitchBankFromTable(a, "banks");
+    EmitResetScroll(a, 0xA0);
+    a.Emit(Op::INC_ZP, ZP_FRAME);
+    EmitRestoreRegistersAndReturn(a);
+
+    a.Label("irq");
+    a.Emit(Op::RTI);
+
+    a.Label("banks");
+    for (int bank = 0; bank < BANK_COUNT; bank++)
+        a.Data({ static_cast<uint8_t>(bank) });
+
+    // Four bands of 16 sprites so every band overflows the 8 sprite per scanline limit
+    a.Label("sprites");
+    for (int i = 0; i < 64; i++)
+    {
+        uint8_t y = static_cast<uint8_t>((i >> 4) * 48 + 32 + (i & 1) * 4);
+        uint8_t tile = static_cast<uint8_t>(i * 2 + 2);
+        uint8_t attributes = static_cast<uint8_t>((i & 0x03) | ((i & 0x04) << 4) | ((i & 0x08) << 4) | ((i & 0x10) << 1));
+        uint8_t x = static_cast<uint8_t>(i * 13);
+        a.Data({ y, tile, attributes, x });
+    }
+
+    a.Label("palette");
+    a.Data(BuildPalette());
+
+    EmitVectors(a, "nmi", "reset", "irq");
+
+    return { "sprite-heavy", INesImage::Build(3, false, a.Assemble(), BuildPatternTables(0x2000 * BANK_COUNT, 0x0BAD)) };
+}
+
+SyntheticRom SyntheticRoms::ApuChannels()
+{
+    constexpr int NOTE_COUNT = 32;
+    constexpr uint8_t ZP_NOTE = ZP_SCRATCH;
+    constexpr uint8_t ZP_FRAME_COUNTER_MODE = ZP_SCRATCH + 1;
+    constexpr uint8_t ZP_STATUS = ZP_SCRATCH + 2;
+
+    // Pentatonic melody, stored as 11-bit timer periods with a length counter load in the high byte
+    static constexpr int SCALE[] = { 0, 2, 4, 7, 9, 12, 14, 16 };
+    std::vector<uint8_t> notesLow, notesHigh;
+    for (int i = 0; i < NOTE_COUNT; i++)
+    {
+        int semitone = SCALE[(i * 3) % 8] + ((i / 8) % 2) * 12;
+        double frequency = 110.0 * std::pow(2.0, semitone / 12.0);
+        int period = static_cast<int>(1789773.0 / (16.0 * frequency) - 1.0);
+        notesLow.push_back(period & 0xFF);
+        notesHigh.push_back(static_cast<uint8_t>(((period >> 8) & 0x07) | (0x01 << 3)));
+    }
+
+    Assembler a(0x8000);
+
+    a.Label("reset");
+    EmitResetPreamble(a);
+    EmitUploadPalette(a, "palette");
+    EmitFillNametables(a);
+
+    a.Emit(Op::LDA_IMM, 0x0F);
+    a.Emit(Op::STA_ABS, APU_STATUS);
+    a.Emit(Op::LDA_IMM, 0x40);
+    a.Emit(Op::STA_ZP, ZP_FRAME_COUNTER_MODE);
+    a.Emit(Op::STA_ABS, APU_FRAME_COUNTER);
+
+    // DMC registers, so the write path is exercised even though the channel is silent
+    a.Emit(Op::LDA_IMM, 0x0F);
+    a.Emit(Op::STA_ABS, 0x4010);
+    a.Emit(Op::LDA_IMM, 0x40);
+    a.Emit(Op::STA_ABS, 0x4011);
+    a.Emit(Op::STA_ABS, 0x4012);
+    a.Emit(Op::STA_ABS, 0x4013);
+
+    EmitEnableRendering(a, 0x80, 0x0A);
+
+    a.Label("main");
+    EmitWaitForNextFrame(a);
+    a.Emit(Op::JSR, "play");
+    a.Emit(Op::JMP_ABS, "main");
+
+    // Start a new note on every channel each 8 frames
+    a.Label("play");
+    a.Emit(Op::LDA_ZP, ZP_FRAME);
+    a.Emit(Op::AND_IMM, 0x07);
+    a.Emit(Op::BNE, "play_done");
+    a.Emit(Op::INC_ZP, ZP_NOTE);
+    a.Emit(Op::LDA_ZP, ZP_NOTE);
+    a.Emit(Op::AND_IMM, NOTE_COUNT - 1);
+    a.Emit(Op::TAX);
+
+    // Pulse 1: decaying envelope with an upward sweep
+    a.Emit(Op::LDA_IMM, 0x86);
+    a.Emit(Op::STA_ABS, 0x4000);
+    a.Emit(Op::LDA_IMM, 0xA3);
+    a.Emit(Op::STA_ABS, 0x4001);
+    a.Emit(Op::LDA_ABX, "notes_low");
+    a.Emit(Op::STA_ABS, 0x4002);
+    a.Emit(Op::LDA_ABX, "notes_high");
+    a.Emit(Op::STA_ABS, 0x4003);
+
+    // Pulse 2: constant volume, halted length counter, downward sweep, offset in the melody
+    a.Emit(Op::LDA_IMM, 0x7F);
+    a.Emit(Op::STA_ABS, 0x4004);
+    a.Emit(Op::LDA_IMM, 0x8B);
+    a.Emit(Op::STA_ABS, 0x4005);
+    a.Emit(Op::TXA);
+    a.Emit(Op::CLC);
+    a.Emit(Op::ADC_IMM, 0x07);
+    a.Emit(Op::AND_IMM, NOTE_COUNT - 1);
+    a.Emit(Op::TAY);
+    a.Emit(Op::LDA_ABY, "notes_low");
+    a.Emit(Op::STA_ABS, 0x4006);
+    a.Emit(Op::LDA_ABY, "notes_high");
+    a.Emit(Op::STA_ABS, 0x4007);
+
+    // Triangle
+    a.Emit(Op::LDA_IMM, 0xC0);
+    a.Emit(Op::STA_ABS, 0x4008);
+    a.Emit(Op::LDA_ABX, "notes_low");
+    a.Emit(Op::STA_ABS, 0x400A);
+    a.Emit(Op::LDA_ABX, "notes_high");
+    a.Emit(Op::STA_ABS, 0x400B);
+
+    // Noise: cycles through every period and both modes
+    a.Emit(Op::LDA_IMM, 0x04);
+    a.Emit(Op::STA_ABS, 0x400C);
+    a.Emit(Op::TXA);
+    a.Emit(Op::ASL_ACC);
+    a.Emit(Op::ASL_ACC);
+    a.Emit(Op::ASL_ACC);
+    a.Emit(Op::AND_IMM, 0x80);
+    a.Emit(Op::STA_ZP, ZP_STATUS);
+    a.Emit(Op::TXA);
+    a.Emit(Op::AND_IMM, 0x0F);
+    a.Emit(Op::ORA_ZP, ZP_STATUS);
+    a.Emit(Op::STA_ABS, 0x400E);
+    a.Emit(Op::LDA_IMM, 0x08);
+    a.Emit(Op::STA_ABS, 0x400F);
+
+    // Alternate between the 4 and 5 step frame counter sequences once per melody
+    a.Emit(Op::TXA);
+    a.Emit(Op::BNE, "play_done");
+    a.Emit(Op::LDA_ZP, ZP_FRAME_COUNTER_MODE);
+    a.Emit(Op::EOR_IMM, 0x80);
+    a.Emit(Op::STA_ZP, ZP_FRAME_COUNTER_MODE);
+    a.Emit(Op::STA_ABS, APU_FRAME_COUNTER);
+
+    a.Label("play_done");
+    a.Emit(Op::LDA_ABS, APU_STATUS);
+    a.Emit(Op::STA_ZP, ZP_STATUS);
+    a.Emit(Op::RTS);
+
+    a.Label("nmi");
+    a.Emit(Op::INC_ZP, ZP_FRAME);
+    a.Label("irq");
+    a.Emit(Op::RTI);
+
+    a.Label("notes_low");
+    a.Data(notesLow);
+    a.Label("notes_high");
+    a.Data(notesHigh);
+
+    a.Label("palette");
+    a.Data(BuildPalette());
+
+    EmitVectors(a, "nmi", "reset", "irq");
+
+    return { "apu-channels", INesImage::Build(0, true, a.Assemble(), BuildPatternTables(0x2000, 0xA0D1)) };
+}
+
+std::vector<SyntheticRom> SyntheticRoms::All()
+{
+    return { CpuLoop(), PpuTraffic(), ScrollSplit(), SpriteHeavy(), ApuChannels() };
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct SyntheticRom
+{
+    std::string name;
+    std::vector<uint8_t> image;
+};
+
+// Deterministic iNES images assembled from source so benchmarks and headless regression runs
+// do not depend on commercial ROMs. Each image targets one workload.
+struct SyntheticRoms
+{
+    // Mapper 0: arithmetic, indexed and indirect RAM traffic with a minimal NMI handler
+    static SyntheticRom CpuLoop();
+
+    // Mapper 2 with CHR RAM: PPUDATA uploads and reads plus OAM DMA every frame from switched PRG banks
+    static SyntheticRom PpuTraffic();
+
+    // Mapper 1: sprite zero hit split with mid-frame scroll, CHR bank and PRG bank changes
+    static SyntheticRom ScrollSplit();
+
+    // Mapper 3: 64 moving 8x16 sprites packed onto shared scanlines with CHR bank switching
+    static SyntheticRom SpriteHeavy();
+
+    // Mapper 0: drives both pulse channels (sweep and envelope), triangle, noise and the frame counter
+    static SyntheticRom ApuChannels();
+
+    static std::vector<SyntheticRom> All();
+};
\ No newline at end of file